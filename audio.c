@@ -0,0 +1,461 @@
+/**
+ * DMA audio output
+ *
+ * The data channel plays one ring block at a time into the sink (the SPI
+ * data register, or a PWM compare register), paced by DMA timer 0. When it finishes a block it chains to
+ * the control channel, which reads the address of the next block from
+ * a ring of block pointers and retriggers the data channel, so playback
+ * is gapless without the CPU. The data channel also raises DMA_IRQ_0 at
+ * the end of every block. The IRQ tops the ring up from the current
+ * source, and makes sure the block that just started was completely
+ * written (padding it with silence if it wasn't). Finally it runs the
+ * mixer over the block that starts next, so that sound effects are
+ * added as late as possible.
+ *
+ * Flash sources are refilled through the XIP streaming interface: the
+ * XIP controller fetches sequential words into its stream FIFO, and
+ * DMA channel 4 moves them into RAM, paced by DREQ_XIP_STREAM. Neither
+ * touches the 16 kB XIP cache.
+ *
+ * Positions in the ring are kept as free-running sample counts, and
+ * masked with AUDIO_RING_SAMPLES-1 to index the buffer.
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/spi.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+#include "hardware/pwm.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "hardware/regs/addressmap.h"
+#include "audio.h"
+
+#define SPI_PORT spi0
+
+#define RING_MASK (AUDIO_RING_SAMPLES - 1)
+
+// Silence in the format the sink consumes
+#if AUDIO_SINK == AUDIO_SINK_PWM
+#define SINK_SILENCE (AUDIO_SILENCE & 0x0fff)
+#else
+#define SINK_SILENCE AUDIO_SILENCE
+#endif
+
+// Select DMA channels
+static int data_chan = 2 ;
+static int ctrl_chan = 3 ;
+static int stream_chan = 4 ;
+
+// The ring, and the addresses of its blocks for the control channel.
+// The block list must be aligned to its size for DMA ring wrapping.
+#define BLOCK_LIST_BYTES (AUDIO_MAX_BLOCKS * sizeof(uint16_t *))
+static uint16_t audio_ring[AUDIO_RING_SAMPLES] __attribute__((aligned(4))) ;
+static uint16_t * audio_block_list[AUDIO_MAX_BLOCKS] __attribute__((aligned(BLOCK_LIST_BYTES))) ;
+
+_Static_assert((AUDIO_RING_SAMPLES & RING_MASK) == 0, "AUDIO_RING_SAMPLES must be a power of 2") ;
+_Static_assert((AUDIO_MAX_BLOCKS & (AUDIO_MAX_BLOCKS - 1)) == 0, "AUDIO_MAX_BLOCKS must be a power of 2") ;
+
+static unsigned int block_samples ;
+static unsigned int num_blocks ;
+
+// Start of the block the DMA is playing, and the next sample to be written.
+// The block being played is always complete: write_pos >= play_pos + block_samples
+static volatile uint32_t play_pos ;
+static volatile uint32_t write_pos ;
+// Everything before mixed_pos has been through the mixer and is in the
+// sink's format
+static volatile uint32_t mixed_pos ;
+static audio_mixer_t audio_mixer = NULL ;
+// Someone is feeding the ring, so running dry is an underrun
+static volatile bool producing = false ;
+
+// Current source, refilled from the IRQ
+static const uint16_t * volatile src_base = NULL ;
+static volatile uint32_t src_count ;
+static volatile uint32_t src_pos ;
+static volatile bool src_loop ;
+
+// Guards all of the above between the IRQ and producers on either core
+static spin_lock_t * audio_lock ;
+
+static audio_stats_t stats ;
+
+// Refill through the stream FIFO, or through the cached window
+static volatile bool use_xip_stream = true ;
+static dma_channel_config stream_cfg ;
+static dma_channel_config cached_cfg ;
+
+// Is this address in the cached XIP window?
+static inline bool in_flash(const void * p) {
+  return ((uintptr_t)p >> 24) == (XIP_BASE >> 24) ;
+}
+
+// Copy count samples into the ring. Flash words go through DMA, anything
+// left over (an odd sample or a misaligned segment) is copied by the CPU
+// through the uncached, non-allocating alias.
+static void copy_samples(uint16_t * dst, const uint16_t * src, uint32_t count) {
+  // Only one refill segment in flight at a time
+  dma_channel_wait_for_finish_blocking(stream_chan) ;
+
+  if (!in_flash(src)) {
+    memcpy(dst, src, count * sizeof(uint16_t)) ;
+    return ;
+  }
+
+  uint32_t words = 0 ;
+  if ((((uintptr_t)src | (uintptr_t)dst) & 3) == 0) {
+    words = count >> 1 ;
+  }
+
+  if (words) {
+    if (use_xip_stream) {
+      // Drain anything left in the stream FIFO, then start a new stream
+      while (!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY_BITS)) {
+        (void) xip_ctrl_hw->stream_fifo ;
+      }
+      xip_ctrl_hw->stream_addr = (uintptr_t) src ;
+      xip_ctrl_hw->stream_ctr = words ;
+      stats.stream_words += words ;
+      dma_channel_configure(stream_chan, &stream_cfg, dst, (const void *) XIP_AUX_BASE, words, true) ;
+    }
+    else {
+      dma_channel_configure(stream_chan, &cached_cfg, dst, src, words, true) ;
+    }
+  }
+
+  const uint16_t * uncached = (const uint16_t *)((uintptr_t)src - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE) ;
+  for (uint32_t i = words * 2; i < count; i++) {
+    dst[i] = uncached[i] ;
+  }
+}
+
+// Fill the ring from the current source up to (but not including) end.
+// Call with audio_lock held.
+static void refill(uint32_t end) {
+  while (src_base != NULL && write_pos != end) {
+    uint32_t index = write_pos & RING_MASK ;
+    uint32_t n = end - write_pos ;
+    // Stop at the end of the buffer and at the end of the source
+    if (n > AUDIO_RING_SAMPLES - index) {
+      n = AUDIO_RING_SAMPLES - index ;
+    }
+    if (n > src_count - src_pos) {
+      n = src_count - src_pos ;
+    }
+    copy_samples(&audio_ring[index], &src_base[src_pos], n) ;
+    write_pos += n ;
+    src_pos += n ;
+
+    // End of the source, loop or stop
+    if (src_pos >= src_count) {
+      src_pos = 0 ;
+      if (!src_loop) {
+        src_base = NULL ;
+        producing = false ;
+      }
+    }
+  }
+  // Samples are in RAM before anyone relies on them
+  dma_channel_wait_for_finish_blocking(stream_chan) ;
+}
+
+// Time until the sample at pos reaches the DAC. Call with audio_lock held.
+static unsigned int delay_until(uint32_t pos) {
+  // Samples left in the block being played, plus everything up to pos
+  uint32_t read_pos = play_pos + block_samples - dma_hw->ch[data_chan].transfer_count ;
+  unsigned int rate = audio_rate_hz() ;
+  if (rate == 0 || (int32_t)(pos - read_pos) < 0) {
+    return 0 ;
+  }
+  return (unsigned int)(((uint64_t)(pos - read_pos) * 1000000u) / rate) ;
+}
+
+// Run the mixer over whatever has been written up to (not including) end,
+// then convert it for the sink. Never touches the block being played.
+// Call with audio_lock held.
+static void mix_up_to(uint32_t end) {
+  uint32_t next_block = play_pos + block_samples ;
+  if ((int32_t)(mixed_pos - next_block) < 0) {
+    mixed_pos = next_block ;
+  }
+  if ((int32_t)(write_pos - end) < 0) {
+    end = write_pos ;
+  }
+  while ((int32_t)(end - mixed_pos) > 0) {
+    uint32_t index = mixed_pos & RING_MASK ;
+    uint32_t n = end - mixed_pos ;
+    if (n > AUDIO_RING_SAMPLES - index) {
+      n = AUDIO_RING_SAMPLES - index ;
+    }
+    if (audio_mixer) {
+      audio_mixer(&audio_ring[index], n, delay_until(mixed_pos)) ;
+    }
+#if AUDIO_SINK == AUDIO_SINK_PWM
+    // PWM compare levels are the bare 12-bit samples
+    for (uint32_t i = index; i < index + n; i++) {
+      audio_ring[i] &= 0x0fff ;
+    }
+#endif
+    mixed_pos += n ;
+  }
+}
+
+// End of a block: the DMA has started on the next one
+static void audio_dma_irq(void) {
+  if (!(dma_hw->ints0 & (1u << data_chan))) {
+    return ;
+  }
+  dma_hw->ints0 = 1u << data_chan ;
+
+  uint32_t begin_time = time_us_32() ;
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+
+  play_pos += block_samples ;
+  stats.blocks++ ;
+
+  // Top up the ring, all the way round to the block being played
+  refill(play_pos + AUDIO_RING_SAMPLES) ;
+
+  // The block that just started must be complete
+  uint32_t end = play_pos + block_samples ;
+  if ((int32_t)(write_pos - end) < 0) {
+    if (producing) {
+      stats.underruns++ ;
+    }
+    while (write_pos != end) {
+      audio_ring[write_pos & RING_MASK] = SINK_SILENCE ;
+      write_pos++ ;
+    }
+  }
+
+  // Mix the block that starts next
+  mix_up_to(play_pos + 2 * block_samples) ;
+
+  uint32_t refill_time = time_us_32() - begin_time ;
+  stats.refill_last_us = refill_time ;
+  stats.refill_total_us += refill_time ;
+  if (refill_time > stats.refill_max_us) {
+    stats.refill_max_us = refill_time ;
+  }
+  spin_unlock(audio_lock, irq_state) ;
+}
+
+void audio_init(unsigned int block) {
+  static bool initialized = false ;
+
+  // Fall back to the default for block sizes the ring can't be split into
+  if (block == 0 || (block & (block - 1)) ||
+      AUDIO_RING_SAMPLES / block < 2 || AUDIO_RING_SAMPLES / block > AUDIO_MAX_BLOCKS) {
+    block = AUDIO_DEFAULT_BLOCK_SAMPLES ;
+  }
+
+  if (!initialized) {
+    audio_lock = spin_lock_instance(spin_lock_claim_unused(true)) ;
+    irq_add_shared_handler(DMA_IRQ_0, audio_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY) ;
+    irq_set_enabled(DMA_IRQ_0, true) ;
+    initialized = true ;
+  }
+  else {
+    // Stop the consumer before changing the block size
+    dma_channel_set_irq0_enabled(data_chan, false) ;
+    dma_channel_abort(ctrl_chan) ;
+    dma_channel_abort(data_chan) ;
+    dma_channel_abort(ctrl_chan) ;
+    dma_hw->ints0 = 1u << data_chan ;
+  }
+
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  block_samples = block ;
+  num_blocks = AUDIO_RING_SAMPLES / block ;
+
+  // Start with the whole ring silent, and the first block complete
+  for (int i = 0; i < AUDIO_RING_SAMPLES; i++) {
+    audio_ring[i] = SINK_SILENCE ;
+  }
+  for (unsigned int i = 0; i < num_blocks; i++) {
+    audio_block_list[i] = &audio_ring[i * block] ;
+  }
+  play_pos = 0 ;
+  write_pos = block ;
+  mixed_pos = block ;
+  producing = false ;
+  src_base = NULL ;
+  memset(&stats, 0, sizeof(stats)) ;
+  spin_unlock(audio_lock, irq_state) ;
+
+  // Refill channel, from the XIP stream FIFO
+  stream_cfg = dma_channel_get_default_config(stream_chan) ;
+  channel_config_set_transfer_data_size(&stream_cfg, DMA_SIZE_32) ;  // stream FIFO is 32 bits wide
+  channel_config_set_read_increment(&stream_cfg, false) ;             // always read the FIFO
+  channel_config_set_write_increment(&stream_cfg, true) ;             // fill the ring
+  channel_config_set_dreq(&stream_cfg, DREQ_XIP_STREAM) ;             // paced by the stream FIFO
+
+  // Refill channel, from the cached XIP window
+  cached_cfg = dma_channel_get_default_config(stream_chan) ;
+  channel_config_set_transfer_data_size(&cached_cfg, DMA_SIZE_32) ;
+  channel_config_set_read_increment(&cached_cfg, true) ;
+  channel_config_set_write_increment(&cached_cfg, true) ;
+
+  // Setup the control channel
+  dma_channel_config c = dma_channel_get_default_config(ctrl_chan) ;  // default configs
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32) ;            // 32-bit txfers
+  channel_config_set_read_increment(&c, true) ;                       // step through the block list
+  channel_config_set_write_increment(&c, false) ;                     // no write incrementing
+  channel_config_set_ring(&c, false, __builtin_ctz(num_blocks * sizeof(uint16_t *))) ; // wrap around the block list
+
+#if AUDIO_SINK == AUDIO_SINK_PWM
+  // PWM at sys_clk / 4096, one 12-bit sample per compare level. A 16-bit
+  // DMA write lands in both halves of CC, channel B is unused.
+  uint slice = pwm_gpio_to_slice_num(AUDIO_PWM_PIN) ;
+  pwm_config pwm_cfg = pwm_get_default_config() ;
+  pwm_config_set_wrap(&pwm_cfg, 0x0fff) ;
+  pwm_init(slice, &pwm_cfg, true) ;
+  pwm_set_chan_level(slice, pwm_gpio_to_channel(AUDIO_PWM_PIN), SINK_SILENCE) ;
+  gpio_set_function(AUDIO_PWM_PIN, GPIO_FUNC_PWM) ;
+  volatile void * sink = &pwm_hw->slice[slice].cc ;
+#else
+  volatile void * sink = &spi_get_hw(SPI_PORT)->dr ;
+#endif
+
+  dma_channel_configure(
+      ctrl_chan,                                // Channel to be configured
+      &c,                                       // The configuration we just created
+      &dma_hw->ch[data_chan].al3_read_addr_trig, // Write address (data channel read address and trigger)
+      audio_block_list,                         // Read address (ring of block addresses)
+      1,                                        // Number of transfers
+      false                                     // Don't start immediately
+  ) ;
+
+  // Setup the data channel
+  dma_channel_config c2 = dma_channel_get_default_config(data_chan) ; // Default configs
+  channel_config_set_transfer_data_size(&c2, DMA_SIZE_16) ;           // 16-bit txfers
+  channel_config_set_read_increment(&c2, true) ;                      // yes read incrementing
+  channel_config_set_write_increment(&c2, false) ;                    // no write incrementing
+  // (X/Y)*sys_clk, where X is the first 16 bytes and Y is the second
+  // sys_clk is 250 MHz. Configured to ~16 kHz
+  dma_timer_set_fraction(0, 0x0004, 0xffff) ;                         // 0xffff for 16 kHz, 0xd903 for 18 kHz, 0xc350 for 20 kHz
+  channel_config_set_dreq(&c2, DREQ_DMA_TIMER0) ;                     // DREQ paced by timer 0
+  channel_config_set_chain_to(&c2, ctrl_chan) ;                       // Chain to control channel
+
+  dma_channel_configure(
+      data_chan,                  // Channel to be configured
+      &c2,                        // The configuration we just created
+      sink,                       // write address (SPI data register or PWM compare)
+      audio_ring,                 // The initial read address
+      block,                      // Number of transfers per block
+      false                       // Don't start immediately.
+  ) ;
+
+  // Interrupt at the end of every block
+  dma_channel_set_irq0_enabled(data_chan, true) ;
+
+  // start the control channel
+  dma_start_channel_mask(1u << ctrl_chan) ;
+}
+
+unsigned int audio_block_samples() {
+  return block_samples ;
+}
+
+void audio_play(const uint16_t * samples, uint32_t count, bool loop) {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  // Drop whatever was queued (and mixed) behind the block being played
+  write_pos = play_pos + block_samples ;
+  mixed_pos = write_pos ;
+  src_base = count ? samples : NULL ;
+  src_count = count ;
+  src_pos = 0 ;
+  src_loop = loop ;
+  producing = (src_base != NULL) ;
+  refill(play_pos + AUDIO_RING_SAMPLES) ;
+  mix_up_to(play_pos + 2 * block_samples) ;
+  spin_unlock(audio_lock, irq_state) ;
+}
+
+void audio_stop() {
+  audio_play(NULL, 0, false) ;
+}
+
+void audio_set_xip_stream(bool enable) {
+  use_xip_stream = enable ;
+}
+
+unsigned int audio_write(const uint16_t * samples, unsigned int count) {
+  unsigned int written = 0 ;
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  if (src_base == NULL) {
+    uint32_t space = play_pos + AUDIO_RING_SAMPLES - write_pos ;
+    if (count > space) {
+      count = space ;
+    }
+    while (written < count) {
+      uint32_t index = write_pos & RING_MASK ;
+      uint32_t n = count - written ;
+      if (n > AUDIO_RING_SAMPLES - index) {
+        n = AUDIO_RING_SAMPLES - index ;
+      }
+      memcpy(&audio_ring[index], &samples[written], n * sizeof(uint16_t)) ;
+      written += n ;
+      write_pos += n ;
+    }
+    producing = true ;
+    // Catch up on mixing the next block if it was written late
+    mix_up_to(play_pos + 2 * block_samples) ;
+  }
+  spin_unlock(audio_lock, irq_state) ;
+  return written ;
+}
+
+unsigned int audio_write_space() {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  unsigned int space = (src_base == NULL) ? play_pos + AUDIO_RING_SAMPLES - write_pos : 0 ;
+  spin_unlock(audio_lock, irq_state) ;
+  return space ;
+}
+
+void audio_set_mixer(audio_mixer_t mixer) {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  audio_mixer = mixer ;
+  spin_unlock(audio_lock, irq_state) ;
+}
+
+void audio_with_next_block(void (*fn)(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg), void * arg) {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  uint32_t next_block = play_pos + block_samples ;
+  unsigned int count = ((int32_t)(mixed_pos - next_block) > 0) ? mixed_pos - next_block : 0 ;
+  fn(&audio_ring[next_block & RING_MASK], count, delay_until(next_block), arg) ;
+  spin_unlock(audio_lock, irq_state) ;
+}
+
+unsigned int audio_rate_hz() {
+  // Timer 0 runs at sys_clk * X / Y
+  uint32_t fraction = dma_hw->timer[0] ;
+  uint32_t x = fraction >> 16 ;
+  uint32_t y = fraction & 0xffff ;
+  if (y == 0) {
+    return 0 ;
+  }
+  return (unsigned int)(((uint64_t)clock_get_hz(clk_sys) * x) / y) ;
+}
+
+unsigned int audio_latency_us() {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  unsigned int latency = delay_until(write_pos) ;
+  spin_unlock(audio_lock, irq_state) ;
+  return latency ;
+}
+
+void audio_get_stats(audio_stats_t * s) {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  *s = stats ;
+  spin_unlock(audio_lock, irq_state) ;
+}
+
+void audio_reset_stats() {
+  uint32_t irq_state = spin_lock_blocking(audio_lock) ;
+  memset(&stats, 0, sizeof(stats)) ;
+  spin_unlock(audio_lock, irq_state) ;
+}
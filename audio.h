@@ -0,0 +1,120 @@
+/**
+ * DMA audio output
+ *
+ * HARDWARE CONNECTIONS (AUDIO_SINK_SPI, the default)
+ *  - GPIO 2 ---> DAC SCK
+ *  - GPIO 3 ---> DAC SDI (MOSI)
+ *  - GPIO 5 ---> DAC CS
+ *  - GPIO 22 ---> DAC LDAC
+ * HARDWARE CONNECTIONS (AUDIO_SINK_PWM)
+ *  - GPIO 28 ---> RC low-pass filter ---> amplifier
+ *
+ * RESOURCES USED
+ *  - DMA channels 2 (data) and 3 (control), paced by DMA timer 0
+ *  - DMA channel 4 (XIP stream refill)
+ *  - DMA_IRQ_0 (shared handler)
+ *  - One claimed hardware spinlock
+ *  - PWM slice 6 (AUDIO_SINK_PWM only)
+ *
+ * Samples are played out of a ring buffer in RAM, split into equal
+ * blocks. The DMA consumer plays one block after another without CPU
+ * help, and raises an IRQ at the end of each block. The ring has one
+ * producer at a time:
+ *  - a source started with audio_play(), which the IRQ refills from
+ *    (flash sources through the XIP streaming interface, so that the
+ *    sequential audio reads don't evict game code from the XIP cache)
+ *  - or, when no source is playing, software calling audio_write()
+ * If the block that starts playing was not completely written, the rest
+ * of it is padded with silence and counted as an underrun.
+ *
+ * An optional mixer (sound effects) is applied to each block at the
+ * last moment: the IRQ at the start of one block mixes the next one.
+ *
+ * Everything upstream of the sink works in MCP4822 DAC words (command
+ * bits in the top nibble, 12-bit sample below). The output backend is
+ * chosen at build time with AUDIO_SINK:
+ *  - AUDIO_SINK_SPI: the DMA writes the words to the SPI DAC as they are
+ *  - AUDIO_SINK_PWM: the words are reduced to bare 12-bit samples after
+ *    mixing, and the DMA writes them to a PWM compare register running
+ *    at sys_clk / 4096 (61 kHz carrier at 250 MHz)
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Output backends
+#define AUDIO_SINK_SPI 0
+#define AUDIO_SINK_PWM 1
+#ifndef AUDIO_SINK
+#define AUDIO_SINK AUDIO_SINK_SPI
+#endif
+
+// PWM output pin (slice 6, channel A)
+#define AUDIO_PWM_PIN 28
+
+// Ring capacity, and the largest number of blocks it can be split into
+#define AUDIO_RING_SAMPLES 1024
+#define AUDIO_MAX_BLOCKS   16
+// Samples per block unless audio_init is told otherwise
+#define AUDIO_DEFAULT_BLOCK_SAMPLES 256
+
+// A-channel, 1x, active, at midscale
+#define AUDIO_SILENCE 0x3800
+
+// Consumer telemetry, see audio_get_stats
+typedef struct {
+  uint32_t blocks ;          // blocks started by the DMA consumer
+  uint32_t underruns ;       // blocks that had to be padded with silence
+  uint32_t refill_last_us ;  // time spent in the most recent end-of-block IRQ
+  uint32_t refill_max_us ;   // worst-case time spent in the end-of-block IRQ
+  uint32_t refill_total_us ; // total time spent in the end-of-block IRQ
+  uint32_t stream_words ;    // 32-bit words DMA'd from flash by the refill channel
+} audio_stats_t ;
+
+// Mixer, called with the audio lock held (from the end-of-block IRQ, or
+// from audio_with_next_block). Adds into count DAC words in place, and
+// must leave the top nibble alone (it may already be converted for the
+// sink). delay_us is the time until samples[0] reaches the DAC.
+typedef void (*audio_mixer_t)(uint16_t * samples, unsigned int count, unsigned int delay_us) ;
+
+// Configure the DMA channels and start playing silence. block_samples
+// must be a power of 2 that splits the ring into 2..AUDIO_MAX_BLOCKS
+// blocks. Calling it again changes the block size (and drops the queue).
+// The end-of-block IRQ is serviced by the core that made the first call.
+void audio_init(unsigned int block_samples) ;
+unsigned int audio_block_samples(void) ;
+
+// Play count DAC words from samples (in flash or RAM), optionally looping.
+// Anything queued behind the current block is dropped.
+void audio_play(const uint16_t * samples, uint32_t count, bool loop) ;
+// Stop the source (or software producer) and go back to silence
+void audio_stop(void) ;
+// true: refill from flash through the XIP stream FIFO (cache bypass)
+// false: refill through the cached XIP window (for comparison)
+void audio_set_xip_stream(bool enable) ;
+
+// Software producer: queue up to count DAC words, returns how many fit.
+// Returns 0 while a source started with audio_play is playing.
+unsigned int audio_write(const uint16_t * samples, unsigned int count) ;
+// Number of samples audio_write would accept right now
+unsigned int audio_write_space(void) ;
+
+// Current sample rate, from the DMA timer 0 fraction
+unsigned int audio_rate_hz(void) ;
+// Time until a sample written now would reach the DAC
+unsigned int audio_latency_us(void) ;
+
+// Install the mixer (NULL for none)
+void audio_set_mixer(audio_mixer_t mixer) ;
+// Call fn with the audio lock held, passing the part of the next block
+// that has already been through the mixer. This lets a new sound effect
+// catch up with the block that starts next instead of the one after.
+void audio_with_next_block(void (*fn)(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg), void * arg) ;
+
+void audio_get_stats(audio_stats_t * stats) ;
+void audio_reset_stats(void) ;
+
+#endif
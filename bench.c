@@ -0,0 +1,359 @@
+/**
+ * Startup benchmarks, see bench.h
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "vga_graphics.h"
+#include "audio.h"
+#include "sfx.h"
+#include "audio_cropped_8bit.h"
+#include "collision.h"
+#include "particles.h"
+#include "starfield.h"
+#include "bench.h"
+
+// How long each measurement runs
+#define BENCH_RUN_US 2000000
+
+// A mix of raster calls with a realistic code footprint, repeated for
+// duration_us. Returns the number of passes completed.
+static unsigned int raster_passes(unsigned int duration_us) {
+  static char text[] = "Current score: 42" ;
+  unsigned int passes = 0 ;
+  unsigned int start = time_us_32() ;
+  while (time_us_32() - start < duration_us) {
+    fillRect(100, 100, 30, 30, RED) ;
+    fillCircle(111, 111, 5, WHITE) ;
+    drawRect(200, 0, 120, 200, WHITE) ;
+    drawLine(107, 107, 115, 115, BLACK) ;
+    setCursor(520, 5) ;
+    setTextSize(1) ;
+    setTextColor(WHITE) ;
+    writeString(text) ;
+    passes++ ;
+  }
+  return passes ;
+}
+
+// Raster throughput with music playing, refilling the audio FIFO through
+// the cached XIP window and then through the XIP stream FIFO
+static void bench_xip_stream() {
+  printf("--- raster throughput with music playing ---\n") ;
+
+  audio_stop() ;
+  xip_ctrl_hw->ctr_hit = 0 ;
+  xip_ctrl_hw->ctr_acc = 0 ;
+  unsigned int passes = raster_passes(BENCH_RUN_US) ;
+  printf("silent:        %6u passes/s, XIP cache hits %u/%u\n",
+         passes * 1000000u / BENCH_RUN_US, (unsigned int) xip_ctrl_hw->ctr_hit, (unsigned int) xip_ctrl_hw->ctr_acc) ;
+
+  audio_reset_stats() ;
+  audio_play(audio_cropped_8bit, AUDIO_CROPPED_8BIT_SAMPLES, true) ;
+  for (int stream = 0; stream < 2; stream++) {
+    audio_set_xip_stream(stream) ;
+    xip_ctrl_hw->ctr_hit = 0 ;
+    xip_ctrl_hw->ctr_acc = 0 ;
+    passes = raster_passes(BENCH_RUN_US) ;
+    printf("%s %6u passes/s, XIP cache hits %u/%u\n",
+           stream ? "XIP stream:   " : "cached XIP:   ",
+           passes * 1000000u / BENCH_RUN_US, (unsigned int) xip_ctrl_hw->ctr_hit, (unsigned int) xip_ctrl_hw->ctr_acc) ;
+  }
+
+  audio_stats_t stats ;
+  audio_get_stats(&stats) ;
+  printf("audio: %u underruns, refill max %u us\n",
+         (unsigned int) stats.underruns, (unsigned int) stats.refill_max_us) ;
+  audio_stop() ;
+}
+
+// Software producer feeding the ring buffer with a square wave for one
+// second, at a few block sizes. Reports the queue latency seen by the
+// producer, underruns and the worst-case time spent in the refill IRQ.
+static void bench_audio_ring() {
+  static const unsigned int block_sizes[] = {64, 128, 256} ;
+  static uint16_t wave[64] ;
+  printf("--- audio ring buffer, software producer ---\n") ;
+
+  for (int i = 0; i < 64; i++) {
+    wave[i] = (i < 32) ? 0x3a00 : 0x3600 ;
+  }
+
+  for (unsigned int b = 0; b < count_of(block_sizes); b++) {
+    audio_init(block_sizes[b]) ;
+    unsigned int max_latency = 0 ;
+    unsigned int start = time_us_32() ;
+    while (time_us_32() - start < 1000000) {
+      audio_write(wave, 64) ;
+      unsigned int latency = audio_latency_us() ;
+      if (latency > max_latency) {
+        max_latency = latency ;
+      }
+      // Let the ring drain a little between writes
+      sleep_us(1000) ;
+    }
+    audio_stop() ;
+
+    audio_stats_t stats ;
+    audio_get_stats(&stats) ;
+    printf("block %3u: %u blocks, %u underruns, max latency %u us, refill max %u us\n",
+           block_sizes[b], (unsigned int) stats.blocks, (unsigned int) stats.underruns,
+           max_latency, (unsigned int) stats.refill_max_us) ;
+  }
+
+  audio_init(AUDIO_DEFAULT_BLOCK_SAMPLES) ;
+}
+
+// Sound effect trigger latency over music, at a few block sizes, and a
+// burst of triggers to exercise voice stealing
+static void bench_sfx() {
+  static const unsigned int block_sizes[] = {64, 128, 256} ;
+  printf("--- sound effect latency ---\n") ;
+
+  for (unsigned int b = 0; b < count_of(block_sizes); b++) {
+    audio_init(block_sizes[b]) ;
+    audio_play(audio_cropped_8bit, AUDIO_CROPPED_8BIT_SAMPLES, true) ;
+    sfx_reset_stats() ;
+    // Triggers at awkward intervals relative to the block period
+    for (int i = 0; i < 50; i++) {
+      sfx_play(SFX_MENU_MOVE) ;
+      sleep_us(23000 + 1700 * (i % 7)) ;
+    }
+    sfx_stats_t stats ;
+    sfx_get_stats(&stats) ;
+    unsigned int block_us = block_sizes[b] * 1000000u / audio_rate_hz() ;
+    printf("block %3u (%5u us): latency max %5u us, last %5u us\n",
+           block_sizes[b], block_us, (unsigned int) stats.latency_max_us, (unsigned int) stats.latency_last_us) ;
+  }
+
+  // Voice stealing. There are as many voices as effects, and an effect
+  // already playing is retriggered, so stealing needs fewer voices: fill
+  // two with distinct effects, then trigger one of higher priority than
+  // the lowest playing (stolen) and one of lower priority than
+  // everything playing (dropped)
+  sfx_stop_all() ;
+  sfx_set_voices(2) ;
+  sfx_reset_stats() ;
+  sfx_play(SFX_MENU_SELECT) ;
+  sfx_play(SFX_MENU_MOVE) ;
+  sfx_play(SFX_BARRIER_PASS) ;
+  sfx_play(SFX_MENU_MOVE) ;
+  sfx_stats_t stats ;
+  sfx_get_stats(&stats) ;
+  printf("stealing: %u triggers, %u steals (expect 1), %u drops (expect 1)%s\n",
+         (unsigned int) stats.triggers, (unsigned int) stats.steals, (unsigned int) stats.drops,
+         (stats.steals == 1 && stats.drops == 1) ? "" : " FAILED") ;
+  sleep_ms(200) ;
+  sfx_set_voices(SFX_VOICES) ;
+
+  audio_stop() ;
+  audio_init(AUDIO_DEFAULT_BLOCK_SAMPLES) ;
+}
+
+// CPU and DMA cost of the compiled-in output backend, per second of
+// music with sound effects. Build with AUDIO_SINK=SPI and AUDIO_SINK=PWM
+// to compare the two.
+static void bench_audio_sink() {
+  printf("--- audio output cost, %s sink ---\n", (AUDIO_SINK == AUDIO_SINK_PWM) ? "PWM" : "SPI") ;
+
+  audio_play(audio_cropped_8bit, AUDIO_CROPPED_8BIT_SAMPLES, true) ;
+  audio_reset_stats() ;
+  unsigned int start = time_us_32() ;
+  while (time_us_32() - start < BENCH_RUN_US) {
+    sfx_play(SFX_PLAYER_MOVE) ;
+    sleep_ms(50) ;
+  }
+  audio_stats_t stats ;
+  audio_get_stats(&stats) ;
+  unsigned int elapsed = time_us_32() - start ;
+  audio_stop() ;
+
+  // Audio actually played, in ms
+  unsigned int played_ms = (unsigned int)((uint64_t) stats.blocks * audio_block_samples() * 1000 / audio_rate_hz()) ;
+  if (played_ms == 0) {
+    return ;
+  }
+  // One transfer per sample, one per block for the control channel,
+  // plus the refill words from flash
+  unsigned int transfers = stats.blocks * (audio_block_samples() + 1) + stats.stream_words ;
+  unsigned int irq_us = (unsigned int)((uint64_t) stats.refill_total_us * 1000 / played_ms) ;
+  printf("%u ms played in %u ms: IRQ %u us/s (%u.%02u%% CPU), refill max %u us\n",
+         played_ms, elapsed / 1000, irq_us, irq_us / 10000, (irq_us / 100) % 100,
+         (unsigned int) stats.refill_max_us) ;
+  printf("DMA: %u transfers/s (%u refill words/s)\n",
+         (unsigned int)((uint64_t) transfers * 1000 / played_ms),
+         (unsigned int)((uint64_t) stats.stream_words * 1000 / played_ms)) ;
+}
+
+// Pairs in the collision benchmark
+#define BENCH_COLLIDE_PAIRS 256
+
+static aabb_t collide_a[BENCH_COLLIDE_PAIRS], collide_b[BENCH_COLLIDE_PAIRS] ;
+static fix15 collide_adx[BENCH_COLLIDE_PAIRS], collide_ady[BENCH_COLLIDE_PAIRS], collide_bdx[BENCH_COLLIDE_PAIRS] ;
+
+// Swept tests per microsecond on game-like pairs (a 30 px player against
+// barrier halves, both moving up to 40 px a tick), against the old
+// end-position overlap test, and how many hits the old test misses
+static void bench_collision() {
+  printf("--- swept collision, %u pairs ---\n", BENCH_COLLIDE_PAIRS) ;
+
+  uint32_t seed = 12345 ;
+  for (int i = 0; i < BENCH_COLLIDE_PAIRS; i++) {
+    seed = seed * 1664525 + 1013904223 ;
+    collide_a[i] = (aabb_t){int2fix15((seed >> 8) % 610), int2fix15((seed >> 20) % 450), int2fix15(30), int2fix15(30)} ;
+    seed = seed * 1664525 + 1013904223 ;
+    int top = (seed >> 8) % 2 ;
+    int h = 20 + (seed >> 12) % 200 ;
+    collide_b[i] = (aabb_t){int2fix15((seed >> 20) % 640), int2fix15(top ? 0 : 480 - h), int2fix15(5 + (seed >> 4) % 60), int2fix15(h)} ;
+    seed = seed * 1664525 + 1013904223 ;
+    collide_adx[i] = (fix15)((seed >> 8) % int2fix15(80)) - int2fix15(40) ;
+    collide_ady[i] = (fix15)((seed >> 16) % int2fix15(80)) - int2fix15(40) ;
+    collide_bdx[i] = -(fix15)((seed >> 4) % int2fix15(40)) ;
+  }
+
+  unsigned int swept_hits = 0, overlap_hits = 0, missed = 0 ;
+  unsigned int start = time_us_32() ;
+  for (int r = 0; r < 100; r++) {
+    for (int i = 0; i < BENCH_COLLIDE_PAIRS; i++) {
+      swept_hits += collide_swept(&collide_a[i], collide_adx[i], collide_ady[i], &collide_b[i], collide_bdx[i], 0, NULL) ;
+    }
+  }
+  unsigned int swept_us = time_us_32() - start ;
+
+  start = time_us_32() ;
+  for (int r = 0; r < 100; r++) {
+    for (int i = 0; i < BENCH_COLLIDE_PAIRS; i++) {
+      aabb_t a = collide_a[i], b = collide_b[i] ;
+      a.x += collide_adx[i] ;
+      a.y += collide_ady[i] ;
+      b.x += collide_bdx[i] ;
+      overlap_hits += collide_overlap(&a, &b) ;
+    }
+  }
+  unsigned int overlap_us = time_us_32() - start ;
+
+  for (int i = 0; i < BENCH_COLLIDE_PAIRS; i++) {
+    aabb_t a = collide_a[i], b = collide_b[i] ;
+    a.x += collide_adx[i] ;
+    a.y += collide_ady[i] ;
+    b.x += collide_bdx[i] ;
+    if (collide_swept(&collide_a[i], collide_adx[i], collide_ady[i], &collide_b[i], collide_bdx[i], 0, NULL) &&
+        !collide_overlap(&a, &b)) {
+      missed++ ;
+    }
+  }
+
+  unsigned int tests = 100 * BENCH_COLLIDE_PAIRS ;
+  printf("swept:   %u.%02u tests/us, %u hits\n", tests / swept_us, (tests * 100 / swept_us) % 100, swept_hits / 100) ;
+  printf("overlap: %u.%02u tests/us, %u hits\n", tests / overlap_us, (tests * 100 / overlap_us) % 100, overlap_hits / 100) ;
+  printf("hits the end-position test misses: %u of %u pairs\n", missed, BENCH_COLLIDE_PAIRS) ;
+
+  // Slow closing speeds: a player one unit clear of a barrier, closing
+  // on it at 1 or 2 units a tick (the player and barrier speeds are 2
+  // units apart after five speed steps). The exit time is far outside
+  // fix15, and must saturate rather than wrap into a miss.
+  unsigned int slow = 0, slow_hits = 0 ;
+  for (fix15 d = 1; d <= 2; d++) {
+    for (int len = 5; len <= 500; len += 45) {
+      aabb_t b = {int2fix15(300), 0, int2fix15(len), int2fix15(200)} ;
+      aabb_t a = {b.x + b.w + 1, int2fix15(100), int2fix15(30), int2fix15(30)} ;
+      slow_hits += collide_swept(&a, -int2fix15(2), 0, &b, -int2fix15(2) + d, 0, NULL) ;
+      a.x = b.x - a.w - 1 ;
+      slow_hits += collide_swept(&a, int2fix15(2), 0, &b, int2fix15(2) - d, 0, NULL) ;
+      slow += 2 ;
+    }
+  }
+  printf("slow closing hits: %u of %u%s\n", slow_hits, slow, (slow_hits == slow) ? "" : " FAILED") ;
+}
+
+// Frames drawn at each particle count
+#define BENCH_PARTICLE_FRAMES 20
+
+static particles_t bench_pool ;
+
+// Cost of a frame of particles (erase, step and draw) at a few counts,
+// per 100 particles, with no budget and then with half the pixels they
+// need, to show what the budget drops
+static void bench_particles() {
+  static const unsigned int counts[] = {64, 128, 256} ;
+  printf("--- particles, %u frames ---\n", BENCH_PARTICLE_FRAMES) ;
+
+  for (int half = 0; half < 2; half++) {
+    for (unsigned int c = 0; c < count_of(counts); c++) {
+      // Long-lived and slow, so none leave the screen or die in the run
+      particles_init(&bench_pool, 12345) ;
+      particles_burst(&bench_pool, 320, 240, counts[c], int2fix15(4), 255, YELLOW) ;
+      unsigned int budget = counts[c] * PARTICLE_PIXELS ;
+      if (half) {
+        budget /= 2 ;
+      }
+      unsigned int start = time_us_32() ;
+      for (int f = 0; f < BENCH_PARTICLE_FRAMES; f++) {
+        particles_erase(&bench_pool) ;
+        particles_step(&bench_pool, 0) ;
+        particles_draw(&bench_pool, budget) ;
+      }
+      unsigned int frame_us = (time_us_32() - start) / BENCH_PARTICLE_FRAMES ;
+      particles_erase(&bench_pool) ;
+      printf("%3u particles, budget %4u px: %4u us/frame, %3u us per 100, %u dropped\n",
+             counts[c], budget, frame_us, frame_us * 100 / counts[c], bench_pool.dropped) ;
+    }
+  }
+}
+
+// Frames moved at each star count
+#define BENCH_STAR_FRAMES 30
+
+static starfield_t bench_stars ;
+
+// Time a frame spends moving the starfield at a few star counts, at the
+// starting barrier speed (5 px a frame), against the 33 ms frame; then
+// how many of the most stars a 1.5 ms cap lets through
+static void bench_starfield() {
+  static const unsigned int counts[] = {64, 128, 256, 512} ;
+  printf("--- starfield, %u frames ---\n", BENCH_STAR_FRAMES) ;
+
+  for (unsigned int c = 0; c < count_of(counts); c++) {
+    fillRect(0, 0, 640, 480, BLACK) ;
+    starfield_init(&bench_stars, counts[c], 12345) ;
+    fix15 scroll = 0 ;
+    unsigned int max_us = 0 ;
+    unsigned int start = time_us_32() ;
+    for (int f = 0; f < BENCH_STAR_FRAMES; f++) {
+      unsigned int frame_start = time_us_32() ;
+      starfield_update(&bench_stars, scroll, 1000000) ;
+      unsigned int frame_us = time_us_32() - frame_start ;
+      if (frame_us > max_us) {
+        max_us = frame_us ;
+      }
+      scroll += int2fix15(5) ;
+    }
+    unsigned int frame_us = (time_us_32() - start) / BENCH_STAR_FRAMES ;
+    printf("%3u stars: %4u us/frame (max %4u), %u.%u%% of a frame\n",
+           counts[c], frame_us, max_us, frame_us * 100 / 33000, (frame_us * 1000 / 33000) % 10) ;
+  }
+
+  unsigned int updated = 0 ;
+  fix15 scroll = 0 ;
+  fillRect(0, 0, 640, 480, BLACK) ;
+  starfield_init(&bench_stars, STARFIELD_MAX, 12345) ;
+  for (int f = 0; f < BENCH_STAR_FRAMES; f++) {
+    updated += starfield_update(&bench_stars, scroll, 1500) ;
+    scroll += int2fix15(5) ;
+  }
+  printf("capped at 1500 us: %u of %u stars a frame, %u frames capped\n",
+         updated / BENCH_STAR_FRAMES, STARFIELD_MAX, bench_stars.capped) ;
+}
+
+void bench_run_all() {
+  bench_xip_stream() ;
+  bench_audio_ring() ;
+  bench_sfx() ;
+  bench_audio_sink() ;
+  bench_collision() ;
+  bench_particles() ;
+  bench_starfield() ;
+
+  fillRect(0, 0, 640, 480, BLACK) ;
+}
@@ -0,0 +1,16 @@
+/**
+ * Startup benchmarks
+ *
+ * Built when the project is configured with -DPROJECT_BENCH=ON. The
+ * benchmarks run once from main, before the scheduler starts, and print
+ * their results over stdio. They draw on the VGA screen and play audio,
+ * and clear the screen when they are done.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// Run every benchmark and print the results
+void bench_run_all(void) ;
+
+#endif
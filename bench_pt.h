@@ -0,0 +1,507 @@
+/**
+ * Protothread and multicore benchmarks
+ *
+ * pt_cornell_rp2040_v1.h defines globals, so it can only be included in
+ * one file. These benchmarks need it, so they are compiled into project.c
+ * by including this file after it, when RUN_BENCHMARKS is defined. They
+ * run from main before core 1 is started, and use core 1 themselves.
+ */
+
+#ifndef BENCH_PT_H
+#define BENCH_PT_H
+
+// Semaphore operations per core in the stress test
+#define BENCH_SEM_OPS 100000
+
+static struct pt_sem bench_sem[2] ;
+static volatile bool bench_go ;
+
+// Signal and take this core's semaphore BENCH_SEM_OPS times, returns usec
+static unsigned int bench_sem_loop(struct pt_sem * s) {
+  while (!bench_go) ;
+  unsigned int start = time_us_32() ;
+  for (int i = 0; i < BENCH_SEM_OPS; i++) {
+    PT_SEM_SAFE_SIGNAL(pt, s) ;
+    pt_sem_lock(s) ;
+    if (s->count > 0) {
+      s->count-- ;
+    }
+    pt_sem_unlock(s) ;
+  }
+  return time_us_32() - start ;
+}
+
+static void bench_sem_core1() {
+  multicore_fifo_push_blocking(bench_sem_loop(&bench_sem[1])) ;
+}
+
+// Both cores hammer their own semaphore at once, first with a spinlock
+// per semaphore, then with both sharing one lock (as all semaphores did
+// with the old global sem_lock)
+static void bench_sem_locks() {
+  printf("--- PT_SEM_SAFE stress, %u signal+take per core ---\n", BENCH_SEM_OPS) ;
+
+  for (int shared = 0; shared < 2; shared++) {
+    if (shared) {
+      spin_lock_unclaim(spin_lock_get_num(bench_sem[1].lock)) ;
+      bench_sem[1].lock = bench_sem[0].lock ;
+    }
+    PT_SEM_SAFE_INIT(&bench_sem[0], 0) ;
+    PT_SEM_SAFE_INIT(&bench_sem[1], 0) ;
+
+    bench_go = false ;
+    multicore_reset_core1() ;
+    multicore_launch_core1(bench_sem_core1) ;
+    bench_go = true ;
+    unsigned int us0 = bench_sem_loop(&bench_sem[0]) ;
+    unsigned int us1 = multicore_fifo_pop_blocking() ;
+
+    unsigned int slowest = (us0 > us1) ? us0 : us1 ;
+    printf("%s: %u lock ops/ms, contention core 0 %u, core 1 %u\n",
+           shared ? "shared lock " : "lock per sem",
+           slowest ? (2 * BENCH_SEM_OPS * 2 * 1000u) / slowest : 0,
+           bench_sem[0].contention, bench_sem[1].contention) ;
+  }
+
+  multicore_reset_core1() ;
+  // Both semaphores are on bench_sem[0]'s lock now; give it back
+  spin_lock_unclaim(spin_lock_get_num(bench_sem[0].lock)) ;
+  bench_sem[0].lock = bench_sem[1].lock = NULL ;
+}
+
+// Words moved core 1 -> core 0 in the queue throughput test
+#define BENCH_QUEUE_WORDS 100000
+// Round trips in the queue latency test
+#define BENCH_QUEUE_TRIPS 1000
+
+static uint32_t bench_queue_buf[2][1024] ;
+static ringq_t bench_queue[2] ;
+static volatile unsigned int bench_batch ;
+
+// core 1: push 0, 1, 2, ... in batches of bench_batch
+static void bench_queue_producer() {
+  uint32_t items[64] ;
+  uint32_t next = 0 ;
+  while (!bench_go) ;
+  while (next < BENCH_QUEUE_WORDS) {
+    unsigned int n = bench_batch ;
+    if (n > BENCH_QUEUE_WORDS - next) {
+      n = BENCH_QUEUE_WORDS - next ;
+    }
+    for (unsigned int i = 0; i < n; i++) {
+      items[i] = next + i ;
+    }
+    unsigned int done = 0 ;
+    while (done < n) {
+      done += ringq_push(&bench_queue[0], items + done, n - done) ;
+    }
+    next += n ;
+  }
+}
+
+// core 1: the same through the SIO FIFO
+static void bench_fifo_producer() {
+  while (!bench_go) ;
+  for (uint32_t i = 0; i < BENCH_QUEUE_WORDS; i++) {
+    multicore_fifo_push_blocking(i) ;
+  }
+}
+
+// core 1: send every word straight back
+static void bench_queue_echo() {
+  uint32_t item ;
+  for (int i = 0; i < BENCH_QUEUE_TRIPS; i++) {
+    while (ringq_pop(&bench_queue[0], &item, 1) == 0) ;
+    while (ringq_push(&bench_queue[1], &item, 1) == 0) ;
+  }
+}
+
+// core 0: receive BENCH_QUEUE_WORDS from core 1, returns words/ms and
+// counts out-of-order words in errors
+static unsigned int bench_queue_receive(bool fifo, unsigned int * errors) {
+  uint32_t items[64] ;
+  uint32_t expect = 0 ;
+  *errors = 0 ;
+  bench_go = true ;
+  unsigned int start = time_us_32() ;
+  while (expect < BENCH_QUEUE_WORDS) {
+    unsigned int n ;
+    if (fifo) {
+      items[0] = multicore_fifo_pop_blocking() ;
+      n = 1 ;
+    }
+    else {
+      n = ringq_pop(&bench_queue[0], items, 64) ;
+    }
+    for (unsigned int i = 0; i < n; i++) {
+      if (items[i] != expect++) (*errors)++ ;
+    }
+  }
+  unsigned int elapsed = time_us_32() - start ;
+  return elapsed ? (unsigned int)((uint64_t) BENCH_QUEUE_WORDS * 1000 / elapsed) : 0 ;
+}
+
+// Core 1 to core 0 throughput for single- and multi-producer queues at a
+// few batch sizes and for the SIO FIFO, then the round-trip latency
+static void bench_queues() {
+  static const unsigned int batches[] = {1, 8, 64} ;
+  unsigned int errors ;
+  printf("--- inter-core queues, %u words ---\n", BENCH_QUEUE_WORDS) ;
+
+  for (int multi = 0; multi < 2; multi++) {
+    ringq_init(&bench_queue[0], bench_queue_buf[0], 1024, multi) ;
+    for (unsigned int b = 0; b < count_of(batches); b++) {
+      bench_queue[0].head = bench_queue[0].tail = 0 ;
+      bench_batch = batches[b] ;
+      bench_go = false ;
+      multicore_reset_core1() ;
+      multicore_launch_core1(bench_queue_producer) ;
+      unsigned int rate = bench_queue_receive(false, &errors) ;
+      printf("%s batch %2u: %6u words/ms, %u full, %u errors\n", multi ? "MPSC" : "SPSC",
+             batches[b], rate, (unsigned int) bench_queue[0].full, errors) ;
+    }
+    if (bench_queue[0].lock) {
+      spin_lock_unclaim(spin_lock_get_num(bench_queue[0].lock)) ;
+    }
+  }
+
+  bench_go = false ;
+  multicore_reset_core1() ;
+  multicore_launch_core1(bench_fifo_producer) ;
+  unsigned int rate = bench_queue_receive(true, &errors) ;
+  printf("SIO FIFO:      %6u words/ms, %u errors\n", rate, errors) ;
+
+  ringq_init(&bench_queue[0], bench_queue_buf[0], 1024, false) ;
+  ringq_init(&bench_queue[1], bench_queue_buf[1], 1024, false) ;
+  multicore_reset_core1() ;
+  multicore_launch_core1(bench_queue_echo) ;
+  unsigned int start = time_us_32() ;
+  for (uint32_t i = 0; i < BENCH_QUEUE_TRIPS; i++) {
+    uint32_t item ;
+    while (ringq_push(&bench_queue[0], &i, 1) == 0) ;
+    while (ringq_pop(&bench_queue[1], &item, 1) == 0) ;
+  }
+  unsigned int elapsed = time_us_32() - start ;
+  printf("round trip: %u ns\n", (unsigned int)((uint64_t) elapsed * 1000 / BENCH_QUEUE_TRIPS)) ;
+
+  multicore_reset_core1() ;
+}
+
+// Timers in the wheel test
+#define BENCH_WHEEL_TIMERS 2000
+
+static unsigned long long bench_wake_at[6] ;
+
+// Sleeps 400 ms four times, then asks for a deadline that has passed
+static PT_THREAD (bench_sleeper(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    static int i ;
+    for (i = 1; i <= 4; i++) {
+      PT_YIELD_usec(400000) ;
+      bench_wake_at[i] = pt_time_us() ;
+    }
+    PT_YIELD_usec(-5000) ;
+    bench_wake_at[5] = pt_time_us() ;
+    PT_END(pt);
+}
+
+static struct pt_timer bench_timers[BENCH_WHEEL_TIMERS] ;
+static unsigned long long bench_fired_at[BENCH_WHEEL_TIMERS] ;
+static unsigned int bench_fired ;
+
+static void bench_timer_fire(struct pt_timer * t, unsigned long long now) {
+  bench_fired_at[t->arg] = now ;
+  bench_fired++ ;
+}
+
+// Expected and actual results of one wrap case, counting errors
+static int bench_wrap_check(const char * what, unsigned int want, unsigned int got) {
+  if (want == got) return 0 ;
+  printf("wrap: %s: want %08x, got %08x\n", what, want, got) ;
+  return 1 ;
+}
+
+// The scheduler keeps releases and idle deadlines in the 32-bit low timer
+// word, which wraps every 71 minutes. Feed its dispatch and idle
+// arithmetic times either side of 0xffffffff (the hardware timer is left
+// alone, the SDK and idle alarms are armed on it), then check that real
+// sleeps and timer wheel timeouts neither fire early nor hang.
+static void bench_timebase() {
+  printf("--- timebase: 32-bit deadlines across the wrap, sleeps, timer wheel ---\n") ;
+  int errors = 0 ;
+
+  // Dispatch: a due thread before the wrap, one due after it, and a
+  // background thread
+  static struct ptx list[3] ;
+  struct ptx *best, *next ;
+  list[0] = (struct ptx){.num = 0, .period = 1000, .priority = 1, .release = 0xfffffff0u} ;
+  list[1] = (struct ptx){.num = 1, .period = 1000, .priority = 2, .release = 0x00000010u} ;
+  list[2] = (struct ptx){.num = 2, .period = 0} ;
+  int background = pt_rate_pick(list, 3, 7, 0xffffff00u, &best, &next) ;
+  errors += bench_wrap_check("nothing due before the wrap", 0, best != NULL) ;
+  errors += bench_wrap_check("next release before the wrap", 0, next ? next->num : -1) ;
+  errors += bench_wrap_check("background threads", 1, background) ;
+  pt_rate_pick(list, 3, 7, 0xfffffff8u, &best, &next) ;
+  errors += bench_wrap_check("due just before the wrap", 0, best ? best->num : -1) ;
+  errors += bench_wrap_check("next release after the wrap", 1, next ? next->num : -1) ;
+  pt_rate_pick(list, 3, 7, 0x00000020u, &best, &next) ;
+  errors += bench_wrap_check("higher priority due after the wrap", 1, best ? best->num : -1) ;
+
+  // Next release across the wrap: on time, then an overrun
+  list[0].release = 0xfffffe00u ;
+  pt_rate_release(&list[0], 0xfffffe10u) ;
+  errors += bench_wrap_check("release across the wrap", 0x000001e8u, list[0].release) ;
+  errors += bench_wrap_check("jitter before the wrap", 0x10, list[0].jitter_max) ;
+  errors += bench_wrap_check("no overrun", 0, list[0].overruns) ;
+  pt_rate_release(&list[0], 0x00000700u) ;
+  errors += bench_wrap_check("overrun after the wrap", 1, list[0].overruns) ;
+  errors += bench_wrap_check("restart after the overrun", 0x00000700u + 1000, list[0].release) ;
+
+  // Idle deadline: the sooner of the next release and the next timer,
+  // with one before the wrap and one after
+  static struct pt_wheel wrap_wheel ;
+  static struct pt_timer wrap_timer ;
+  unsigned long long wrap = 1ull << 32 ;
+  unsigned int deadline = 0 ;
+  list[1].release = 0x00000010u ;
+  pt_timer_add(&wrap_wheel, &wrap_timer, wrap - 0x400, wrap - 0x800) ;
+  bool timed = pt_idle_deadline(&list[1], &wrap_wheel, &deadline) ;
+  errors += bench_wrap_check("timed", 1, timed) ;
+  errors += bench_wrap_check("timer before the release", (unsigned int)(wrap - 0x400), deadline) ;
+  pt_timer_add(&wrap_wheel, &wrap_timer, wrap + 0x400, wrap - 0x800) ;
+  pt_idle_deadline(&list[1], &wrap_wheel, &deadline) ;
+  errors += bench_wrap_check("release before the timer", 0x00000010u, deadline) ;
+  pt_timer_cancel(&wrap_wheel, &wrap_timer) ;
+  // and the idle loop's test of it
+  errors += bench_wrap_check("deadline after the wrap not due", 0, pt_due(0xfffffff0u, 0x00000010u)) ;
+  errors += bench_wrap_check("deadline after the wrap due", 1, pt_due(0x00000011u, 0x00000010u)) ;
+  errors += bench_wrap_check("deadline before the wrap due", 1, pt_due(0x00000011u, 0xfffffff0u)) ;
+
+  // Sleeps, polled since no scheduler is running
+  struct pt sleeper ;
+  unsigned int missed = pt_missed_deadlines[0] ;
+  PT_INIT(&sleeper) ;
+  bench_wake_at[0] = pt_time_us() ;
+  while (PT_SCHEDULE(bench_sleeper(&sleeper))) ;
+  for (int i = 1; i <= 4; i++) {
+    long long slept = bench_wake_at[i] - bench_wake_at[i - 1] ;
+    if (slept < 400000 || slept > 400100) errors++ ;
+    printf("sleep %d: %lld us\n", i, slept) ;
+  }
+  printf("past deadline: %u missed, returned after %u us\n",
+         pt_missed_deadlines[0] - missed, (unsigned int)(bench_wake_at[5] - bench_wake_at[4])) ;
+  if (pt_missed_deadlines[0] - missed != 1) errors++ ;
+
+  // Timer wheel, fed timeouts from 0 to 2 s, driven the way an idle
+  // scheduler drives it
+  static struct pt_wheel wheel ;
+  unsigned long long now = pt_time_us() ;
+  uint32_t seed = 12345 ;
+  bench_fired = 0 ;
+  unsigned int start = time_us_32() ;
+  for (int i = 0; i < BENCH_WHEEL_TIMERS; i++) {
+    seed = seed * 1664525 + 1013904223 ;
+    bench_timers[i].fire = bench_timer_fire ;
+    bench_timers[i].arg = i ;
+    pt_timer_add(&wheel, &bench_timers[i], now + (seed >> 11) % 2000000, now) ;
+  }
+  unsigned int add_us = time_us_32() - start ;
+  unsigned long long when ;
+  unsigned int advances = 0 ;
+  while (pt_wheel_next(&wheel, &when)) {
+    while (pt_time_us() < when) ;
+    pt_wheel_advance(&wheel, pt_time_us()) ;
+    advances++ ;
+  }
+  unsigned long long late_max = 0 ;
+  for (int i = 0; i < BENCH_WHEEL_TIMERS; i++) {
+    if (bench_fired_at[i] < bench_timers[i].expires) errors++ ;
+    else if (bench_fired_at[i] - bench_timers[i].expires > late_max) late_max = bench_fired_at[i] - bench_timers[i].expires ;
+  }
+  printf("wheel: %u timers, %u fired, %u ns per add, %u advances, latest %u us\n",
+         BENCH_WHEEL_TIMERS, bench_fired, add_us * 1000 / BENCH_WHEEL_TIMERS, advances, (unsigned int) late_max) ;
+  if (bench_fired != BENCH_WHEEL_TIMERS) errors++ ;
+
+  printf("%s (%d errors)\n", errors ? "FAIL" : "pass", errors) ;
+}
+
+// Lines of BENCH_SERIAL_LINE characters (the last one a <enter>) in
+// the serial test
+#define BENCH_SERIAL_LINES 128
+#define BENCH_SERIAL_LINE 64
+
+static volatile unsigned int bench_idle_polls ;
+
+// What the serial test's main loop does when it has nothing to send and
+// no line to take: count a pass, whose cost is measured on its own
+static void __attribute__((noinline)) bench_serial_idle() {
+  bench_idle_polls++ ;
+}
+
+// Serial throughput and CPU cost with the UART looped back on itself:
+// lines go out through the TX ring and DMA, come back through the RX
+// IRQ's line assembly, and are checked. The CPU cost is the part of the
+// run not spent in the idle loop.
+static void bench_serial() {
+  static const unsigned int bauds[] = {115200, 1000000} ;
+  static char line[BENCH_SERIAL_LINE] ;
+  char got[pt_buffer_size] ;
+  unsigned int rate[2], cpu[2], errors[2], dropped[2] ;
+  printf("--- serial I/O, %u lines of %u bytes, loopback ---\n", BENCH_SERIAL_LINES, BENCH_SERIAL_LINE) ;
+
+  for (int i = 0; i < BENCH_SERIAL_LINE - 1; i++) {
+    line[i] = 'A' + i % 26 ;
+  }
+  line[BENCH_SERIAL_LINE - 1] = '\r' ;
+
+  // cost of one idle loop pass
+  bench_idle_polls = 0 ;
+  unsigned int start = time_us_32() ;
+  for (int i = 0; i < 100000; i++) {
+    bench_serial_idle() ;
+  }
+  unsigned int idle_ns = (time_us_32() - start) * 1000u / 100000 ;
+
+  pt_serial_init() ;
+  uart_tx_wait_blocking(UART_ID) ;
+  pt_serial_echo = false ;
+  hw_set_bits(&uart_get_hw(UART_ID)->cr, UART_UARTCR_LBE_BITS) ;
+  for (unsigned int b = 0; b < count_of(bauds); b++) {
+    uart_set_baudrate(UART_ID, bauds[b]) ;
+    unsigned int sent = 0, lines = 0, total = BENCH_SERIAL_LINES * BENCH_SERIAL_LINE ;
+    unsigned int drop0 = pt_serial_rx_dropped ;
+    // give up at twice the time it should take
+    unsigned int timeout = (unsigned int)((uint64_t) total * 10 * 2000000 / bauds[b]) ;
+    errors[b] = 0 ;
+    bench_idle_polls = 0 ;
+    start = time_us_32() ;
+    while (lines < BENCH_SERIAL_LINES && time_us_32() - start < timeout) {
+      if (sent < total && pt_serial_tx_space() > 0) {
+        unsigned int at = sent % BENCH_SERIAL_LINE ;
+        sent += pt_serial_tx_put(line + at, BENCH_SERIAL_LINE - at) ;
+      }
+      else if (pt_serial_rx_get(got, sizeof(got)) >= 0) {
+        if (strncmp(got, line, BENCH_SERIAL_LINE - 1) != 0 || got[BENCH_SERIAL_LINE - 1] != 0) errors[b]++ ;
+        lines++ ;
+      }
+      else {
+        bench_serial_idle() ;
+      }
+    }
+    unsigned int elapsed = time_us_32() - start ;
+    unsigned int idle_us = (unsigned int)((uint64_t) bench_idle_polls * idle_ns / 1000) ;
+    rate[b] = elapsed ? (unsigned int)((uint64_t) lines * BENCH_SERIAL_LINE * 1000000 / elapsed) : 0 ;
+    cpu[b] = (elapsed && idle_us < elapsed) ? (unsigned int)((uint64_t)(elapsed - idle_us) * 1000 / elapsed) : 0 ;
+    errors[b] += BENCH_SERIAL_LINES - lines ;
+    dropped[b] = pt_serial_rx_dropped - drop0 ;
+  }
+  // let the TX DMA drain before it is stopped
+  while (pt_serial_tx_head != pt_serial_tx_tail) ;
+  uart_tx_wait_blocking(UART_ID) ;
+  hw_clear_bits(&uart_get_hw(UART_ID)->cr, UART_UARTCR_LBE_BITS) ;
+  uart_set_baudrate(UART_ID, PICO_DEFAULT_UART_BAUD_RATE) ;
+  pt_serial_echo = true ;
+  // stdio shares the UART: give it back
+  pt_serial_deinit() ;
+
+  for (unsigned int b = 0; b < count_of(bauds); b++) {
+    printf("%7u baud: %6u bytes/s of %6u, CPU %u.%u%%, %u lines dropped, %u errors\n",
+           bauds[b], rate[b], bauds[b] / 10, cpu[b] / 10, cpu[b] % 10, dropped[b], errors[b]) ;
+  }
+}
+
+// Calls in the dispatch and profiler overhead tests
+#define BENCH_DISPATCH_CALLS 100000
+
+// A thread that only counts and yields, the worst case for per-call
+// overhead, with its state in a static
+static PT_THREAD (bench_yielder(struct pt *pt))
+{
+    static unsigned int count ;
+    PT_BEGIN(pt);
+    while(1) {
+      count++ ;
+      PT_YIELD(pt);
+    }
+    PT_END(pt);
+}
+
+// The same as a reentrant thread, with its state in its context
+static PT_THREAD (bench_yielder_ctx(struct pt *pt, void *ctx))
+{
+    unsigned int *count = ctx ;
+    PT_BEGIN(pt);
+    while(1) {
+      (*count)++ ;
+      PT_YIELD(pt);
+    }
+    PT_END(pt);
+}
+
+// ns per call of BENCH_DISPATCH_CALLS calls of ptx through pt_run
+static unsigned int bench_dispatch_ns(struct ptx *ptx) {
+  PT_INIT(&ptx->pt) ;
+  unsigned int start = time_us_32() ;
+  for (int i = 0; i < BENCH_DISPATCH_CALLS; i++) {
+    pt_run(0, ptx) ;
+  }
+  unsigned int elapsed = time_us_32() - start ;
+  pt_current[0] = -1 ;
+  return elapsed * 1000u / BENCH_DISPATCH_CALLS ;
+}
+
+// Scheduler dispatch cost of a thread with static state against the
+// same thread with its state in a context passed through its ptx
+static void bench_dispatch() {
+  static struct ptx plain, reentrant ;
+  static unsigned int count ;
+  printf("--- protothread dispatch, %u calls ---\n", BENCH_DISPATCH_CALLS) ;
+
+  plain.pf = bench_yielder ;
+  reentrant.pfc = bench_yielder_ctx ;
+  reentrant.ctx = &count ;
+  unsigned int plain_ns = bench_dispatch_ns(&plain) ;
+  unsigned int ctx_ns = bench_dispatch_ns(&reentrant) ;
+  printf("static state %u ns, context %u ns per call, %u calls counted\n",
+         plain_ns, ctx_ns, count) ;
+}
+
+#ifdef PT_PROFILE
+
+// Cost of the profiler's bookkeeping: the same trivial thread called
+// directly and through pt_run
+static void bench_profile() {
+  static struct ptx ptx ;
+  printf("--- profiler overhead, %u calls ---\n", BENCH_DISPATCH_CALLS) ;
+
+  ptx.pf = bench_yielder ;
+  PT_INIT(&ptx.pt) ;
+  unsigned int start = time_us_32() ;
+  for (int i = 0; i < BENCH_DISPATCH_CALLS; i++) {
+    (ptx.pf)(&ptx.pt) ;
+  }
+  unsigned int direct = time_us_32() - start ;
+  start = time_us_32() ;
+  for (int i = 0; i < BENCH_DISPATCH_CALLS; i++) {
+    pt_run(0, &ptx) ;
+  }
+  unsigned int profiled = time_us_32() - start ;
+  pt_current[0] = -1 ;
+  printf("direct %u ns, profiled %u ns per call\n",
+         direct * 1000u / BENCH_DISPATCH_CALLS, profiled * 1000u / BENCH_DISPATCH_CALLS) ;
+}
+#endif
+
+void bench_pt_run_all() {
+  bench_timebase() ;
+  bench_sem_locks() ;
+  bench_queues() ;
+  bench_serial() ;
+  bench_dispatch() ;
+#ifdef PT_PROFILE
+  bench_profile() ;
+#endif
+}
+
+#endif
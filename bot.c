@@ -0,0 +1,150 @@
+/**
+ * Autopilot, see bot.h
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "input.h"
+#include "bot.h"
+
+// Player size, and how far right and down it can go (as clamped by the
+// game)
+#define PLAYER_SIZE int2fix15(30)
+#define PLAYER_MAX_X int2fix15(610)
+#define PLAYER_MAX_Y int2fix15(450)
+
+// Cost of a tick spent touching a barrier, more than any path of
+// BOT_HORIZON ticks spent anywhere else
+#define BLOCKED (1u << 20)
+
+// Heights the player can be at, per tick: lo..hi, with mid the middle
+// of the tunnel it is in or heading for
+static fix15 lo[BOT_HORIZON + 1], hi[BOT_HORIZON + 1], mid[BOT_HORIZON + 1] ;
+// Cost of the best path from tick t to the horizon, for each height
+// y + (j - BOT_HORIZON) * step, at t and t + 1
+static uint32_t cost[2][2 * BOT_HORIZON + 1] ;
+
+// Work out lo, hi and mid for each tick of the search, for a player
+// starting at x and moving dx a tick
+static void plan_openings(const bot_view_t * v, fix15 x0, fix15 dx) {
+  fix15 margin = int2fix15(BOT_MARGIN) ;
+  for (int t = 0; t <= BOT_HORIZON; t++) {
+    fix15 shift = v->speed * t ;
+    fix15 x = x0 + dx * t ;
+    fix15 next_x = 0 ;
+    bool ahead = false ;
+    if (x < 0) x = 0 ;
+    if (x > PLAYER_MAX_X) x = PLAYER_MAX_X ;
+    lo[t] = 0 ;
+    hi[t] = PLAYER_MAX_Y ;
+    mid[t] = PLAYER_MAX_Y / 2 ;
+    for (unsigned int i = 0; i < v->barriers; i++) {
+      fix15 bx = v->x[i] - shift ;
+      if (bx + v->length[i] + margin <= x) {
+        continue ;
+      }
+      fix15 top = v->top[i] + margin ;
+      fix15 bottom = v->bottom[i] - PLAYER_SIZE - margin ;
+      if (bx < x + PLAYER_SIZE + margin) {
+        // Overlapping the player's column: only the tunnel is open
+        if (top > lo[t]) lo[t] = top ;
+        if (bottom < hi[t]) hi[t] = bottom ;
+        mid[t] = (top + bottom) / 2 ;
+        next_x = bx ;
+        ahead = true ;
+      }
+      else if (!ahead || bx < next_x) {
+        // Line up with the nearest tunnel still coming
+        mid[t] = (top + bottom) / 2 ;
+        next_x = bx ;
+        ahead = true ;
+      }
+    }
+  }
+}
+
+// Cost of being at height y at tick t
+static inline uint32_t tick_cost(int t, fix15 y) {
+  if (y < lo[t] || y > hi[t]) {
+    return BLOCKED ;
+  }
+  fix15 off = (y > mid[t]) ? y - mid[t] : mid[t] - y ;
+  return (uint32_t) fix2int15(off) ;
+}
+
+// Search the heights for a player at x0, y0 that keeps moving dx a tick.
+// Returns the cost of the cheapest plan, and its first vertical move in
+// bits.
+static uint32_t plan(const bot_view_t * v, fix15 x0, fix15 y0, fix15 dx, unsigned int * bits) {
+  plan_openings(v, x0, dx) ;
+
+  // From the horizon back to the next tick, the cheapest way on from
+  // every reachable height (heights off the screen are never taken)
+  for (int t = BOT_HORIZON; t >= 1; t--) {
+    uint32_t * now = cost[t & 1] ;
+    const uint32_t * next = cost[(t + 1) & 1] ;
+    for (int j = BOT_HORIZON - t; j <= BOT_HORIZON + t; j++) {
+      fix15 y = y0 + (j - BOT_HORIZON) * v->step ;
+      if (y < 0 || y > PLAYER_MAX_Y) {
+        now[j] = UINT32_MAX ;
+        continue ;
+      }
+      uint32_t c = tick_cost(t, y) ;
+      if (t < BOT_HORIZON) {
+        // Stay first, so a tie doesn't move the player
+        uint32_t best = next[j] ;
+        if (next[j - 1] < best) best = next[j - 1] ;
+        if (next[j + 1] < best) best = next[j + 1] ;
+        c = (best == UINT32_MAX) ? UINT32_MAX : c + best ;
+      }
+      now[j] = c ;
+    }
+  }
+
+  // First move: up is one step lower in j
+  const uint32_t * first = cost[1] ;
+  uint32_t best = first[BOT_HORIZON] ;
+  *bits = 0 ;
+  if (first[BOT_HORIZON - 1] < best) {
+    best = first[BOT_HORIZON - 1] ;
+    *bits = INPUT_UP ;
+  }
+  if (first[BOT_HORIZON + 1] < best) {
+    best = first[BOT_HORIZON + 1] ;
+    *bits = INPUT_DOWN ;
+  }
+  return best ;
+}
+
+unsigned int bot_steer(const bot_view_t * v, unsigned int player) {
+  if (player >= v->players) {
+    return 0 ;
+  }
+  fix15 x = v->player_x[player] ;
+  fix15 y = v->player_y[player] ;
+
+  // Horizontal moves in order of preference: back towards home, holding
+  // still, and backing off to the left, which slows the barriers down
+  // relative to the player and buys time to line up
+  unsigned int moves[3] = {INPUT_RIGHT, 0, INPUT_LEFT} ;
+  if (x >= int2fix15(BOT_HOME_X)) {
+    moves[0] = 0 ;
+    moves[1] = INPUT_LEFT ;
+  }
+  unsigned int choice = 0 ;
+  uint32_t best = UINT32_MAX ;
+  for (int m = 0; m < 3 - (moves[1] == INPUT_LEFT); m++) {
+    fix15 dx = (moves[m] == INPUT_RIGHT) ? v->step : (moves[m] == INPUT_LEFT) ? -v->step : 0 ;
+    unsigned int bits ;
+    uint32_t c = plan(v, x, y, dx, &bits) ;
+    if (c < best) {
+      best = c ;
+      choice = moves[m] | bits ;
+    }
+    // The first plan that clears every barrier will do
+    if (c < BLOCKED) {
+      break ;
+    }
+  }
+  return choice ;
+}
@@ -0,0 +1,58 @@
+/**
+ * Autopilot: steers players through the barriers, for unattended runs
+ *
+ * bot_steer works on a copy of the game (a bot_view_t), so it can run on
+ * either core. It searches the next BOT_HORIZON ticks with a dynamic
+ * program over the player's height: every tick the barriers scroll left
+ * at the current speed, and the player moves one step up, one step down,
+ * or stays. A height where the player would touch a barrier costs far
+ * more than any other, and the distance from the middle of the tunnel
+ * just ahead breaks ties, so the player lines up for tunnels early. The
+ * result is the joystick bits (INPUT_UP..) of the first move of the
+ * cheapest plan.
+ *
+ * The search is run for each horizontal move held over the whole horizon:
+ * back towards BOT_HOME_X, holding still, or backing off to the left,
+ * which slows the barriers down relative to the player when it needs
+ * more time to reach a tunnel. The first of these that clears every
+ * barrier is used.
+ */
+
+#ifndef BOT_H
+#define BOT_H
+
+#include "fix15.h"
+#include "obstacles.h"
+
+// Ticks the search looks ahead
+#ifndef BOT_HORIZON
+#define BOT_HORIZON 96
+#endif
+// Clearance kept from barrier edges, pixels
+#ifndef BOT_MARGIN
+#define BOT_MARGIN 3
+#endif
+// Where players are kept across the screen when there is no need to back
+// off, pixels: well to the right, to leave room for backing off
+#ifndef BOT_HOME_X
+#define BOT_HOME_X 400
+#endif
+
+// What the bot sees of the game, all in fix15 pixels
+typedef struct {
+  fix15 speed ;                       // barrier speed per tick
+  fix15 step ;                        // player speed per tick on each axis
+  unsigned int players ;
+  fix15 player_x[2] ;                 // top left of each 30 x 30 player
+  fix15 player_y[2] ;
+  unsigned int barriers ;
+  fix15 x[OBSTACLES_MAX] ;            // as in obstacles_t
+  fix15 length[OBSTACLES_MAX] ;
+  fix15 top[OBSTACLES_MAX] ;
+  fix15 bottom[OBSTACLES_MAX] ;
+} bot_view_t ;
+
+// Joystick bits for player's next move
+unsigned int bot_steer(const bot_view_t * view, unsigned int player) ;
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Swept box collisions, see collision.h
+ */
+
+#include "pico/stdlib.h"
+#include "collision.h"
+
+#define FIX15_MIN ((fix15) 0x80000000)
+#define FIX15_MAX ((fix15) 0x7fffffff)
+
+// num / d as a time, saturated: the quotient of a long way over a slow
+// closing speed is far outside fix15, and wrapping it would make a real
+// hit look like a miss
+static fix15 time_div(fix15 num, fix15 d) {
+  signed long long q = div_s64s64(((signed long long) num) << 15, (signed long long) d) ;
+  if (q > FIX15_MAX) return FIX15_MAX ;
+  if (q < FIX15_MIN) return FIX15_MIN ;
+  return (fix15) q ;
+}
+
+// Entry and exit times of one axis: the mover's interval [a0, a1]
+// travelling d against the still interval [b0, b1]. Only called when the
+// intervals are apart at the start or d moves them.
+static void axis_times(fix15 a0, fix15 a1, fix15 b0, fix15 b1, fix15 d, fix15 * entry, fix15 * exit) {
+  if (d > 0) {
+    *entry = time_div(b0 - a1, d) ;
+    *exit = time_div(b1 - a0, d) ;
+  }
+  else if (d < 0) {
+    *entry = time_div(b1 - a0, d) ;
+    *exit = time_div(b0 - a1, d) ;
+  }
+  else {
+    // not moving on this axis: the broad phase found them overlapping
+    *entry = FIX15_MIN ;
+    *exit = FIX15_MAX ;
+  }
+}
+
+bool collide_swept(const aabb_t * a, fix15 adx, fix15 ady,
+                   const aabb_t * b, fix15 bdx, fix15 bdy, collision_t * hit) {
+  // Work in the obstacle's frame
+  fix15 dx = adx - bdx ;
+  fix15 dy = ady - bdy ;
+  fix15 ax0 = a->x, ax1 = a->x + a->w, ay0 = a->y, ay1 = a->y + a->h ;
+  fix15 bx0 = b->x, bx1 = b->x + b->w, by0 = b->y, by1 = b->y + b->h ;
+
+  // Broad phase: the box swept by the mover, most tests end here
+  if ((dx > 0 ? ax1 + dx : ax1) < bx0 || (dx < 0 ? ax0 + dx : ax0) > bx1 ||
+      (dy > 0 ? ay1 + dy : ay1) < by0 || (dy < 0 ? ay0 + dy : ay0) > by1) {
+    return false ;
+  }
+
+  // Touching from the start
+  if (ax1 >= bx0 && ax0 <= bx1 && ay1 >= by0 && ay0 <= by1) {
+    if (hit) {
+      hit->toi = 0 ;
+      hit->side = COLLIDE_INSIDE ;
+    }
+    return true ;
+  }
+
+  // The first contact is when the later axis starts to overlap, as long
+  // as the other has not stopped overlapping by then
+  fix15 tx_entry, tx_exit, ty_entry, ty_exit ;
+  axis_times(ax0, ax1, bx0, bx1, dx, &tx_entry, &tx_exit) ;
+  axis_times(ay0, ay1, by0, by1, dy, &ty_entry, &ty_exit) ;
+  fix15 entry = (tx_entry > ty_entry) ? tx_entry : ty_entry ;
+  fix15 exit = (tx_exit < ty_exit) ? tx_exit : ty_exit ;
+  if (entry > exit || entry < 0 || entry > int2fix15(1)) {
+    return false ;
+  }
+
+  if (hit) {
+    hit->toi = entry ;
+    if (tx_entry > ty_entry) {
+      hit->side = (dx > 0) ? COLLIDE_LEFT : COLLIDE_RIGHT ;
+    }
+    else {
+      hit->side = (dy > 0) ? COLLIDE_TOP : COLLIDE_BOTTOM ;
+    }
+  }
+  return true ;
+}
@@ -0,0 +1,43 @@
+/**
+ * Swept axis-aligned box collisions, in fix15 pixels
+ *
+ * Two boxes that each move in a straight line during one simulation tick
+ * are tested for the first moment they touch, rather than only at their
+ * end positions, so a fast mover can't step over a thin obstacle (or an
+ * obstacle over a mover) between ticks. Boxes are closed: touching edges
+ * count as a hit, as the game's old overlap test did.
+ */
+
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <stdbool.h>
+#include "fix15.h"
+
+// Box with its top left corner at (x, y)
+typedef struct {
+  fix15 x, y ;
+  fix15 w, h ;
+} aabb_t ;
+
+// Side of the obstacle that the mover ran into
+enum collide_side {COLLIDE_NONE, COLLIDE_INSIDE, COLLIDE_LEFT, COLLIDE_RIGHT, COLLIDE_TOP, COLLIDE_BOTTOM} ;
+
+typedef struct {
+  fix15 toi ;               // time of impact, as a fraction of the tick (0..1)
+  enum collide_side side ;  // COLLIDE_INSIDE if they already touched at the start
+} collision_t ;
+
+// Mover a travels (adx, ady) and obstacle b travels (bdx, bdy) during the
+// tick, both starting from the given boxes. Returns true and fills in hit
+// (if not NULL) if they touch during the tick.
+bool collide_swept(const aabb_t * a, fix15 adx, fix15 ady,
+                   const aabb_t * b, fix15 bdx, fix15 bdy, collision_t * hit) ;
+
+// The old test: do the boxes touch where they are
+static inline bool collide_overlap(const aabb_t * a, const aabb_t * b) {
+  return a->x + a->w >= b->x && a->x <= b->x + b->w &&
+         a->y + a->h >= b->y && a->y <= b->y + b->h ;
+}
+
+#endif
@@ -1,32 +0,0 @@
-const uint16_t death_crash_cropped[] = {
-0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,
-0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,
-0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x37f0,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x3800,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x3810,0x3810,0x3820,0x3810,0x3810,0x3810,0x3810,0x3800,0x3800,0x37f0,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3820,0x3810,0x3820,0x3810,0x3820,0x3820,0x3810,0x3800,0x3810,0x3800,0x3810,0x3800,0x3820,0x3820,0x3810,0x37f0,0x37d0,0x3810,0x3800,0x3800,0x3830,0x3810,0x3810,0x3820,0x37d0,0x3810,0x3850,0x38d0,0x38c0,0x3970,0x3720,0x3400,0x3480,0x3440,0x34a0,0x3490,0x34c0,0x34b0,0x34d0,0x3470,0x3440,0x3450,0x3490,0x3480,0x3510,0x3540,0x34d0,0x3530,0x34d0,0x3560,0x3510,0x3580,0x3500,0x3530,0x33e0,0x33f0,0x3270,0x3590,0x3ce0,0x3d10,0x3cc0,0x3be0,0x3b60,0x3af0,0x3b10,0x3b80,0x3c00,0x3c70,0x3d90,0x3d90,
-0x3f50,0x38f0,0x3380,0x35a0,0x3590,0x3700,0x36e0,0x3780,0x3790,0x3700,0x3670,0x35e0,0x3580,0x34c0,0x3990,0x3f00,0x3e50,0x3e00,0x3d40,0x3d00,0x3ca0,0x3cb0,0x3c80,0x3ca0,0x3cb0,0x3c70,0x3ca0,0x3cb0,0x3dc0,0x3da0,0x3d50,0x3d00,0x3cf0,0x3ca0,0x3cc0,0x3c90,0x3d20,0x3d00,0x3e70,0x3e10,0x3fd0,0x39b0,0x3b0,0x3230,0x31c0,0x32f0,0x3330,0x33f0,0x33b0,0x3360,0x3390,0x3330,0x3320,0x3320,0x3300,0x31a0,0x3150,0x3140,0x31a0,0x3180,0x3170,0x3160,0x3170,0x3130,0x3150,0x3140,0x3150,0x3130,0x31a0,0x32e0,0x32b0,0x32e0,0x3290,0x3310,0x3310,0x3370,0x3310,0x32f0,0x3280,0x3210,0x3e0,0x3280,0x39b0,0x3b70,0x3aa0,0x3a30,0x3970,0x3960,0x38d0,0x3930,0x39c0,0x39c0,0x3ae0,0x3b10,0x3ce0,0x35b0,0x300,0x31c0,0x3170,0x32a0,0x3260,0x3370,0x3370,0x3340,0x32c0,0x32a0,0x3290,0x3280,0x3280,0x3390,0x33f0,0x3390,0x33c0,0x33b0,0x3420,0x33c0,0x3430,0x3370,0x33b0,0x32a0,0x3300,0x3100,0x35c0,0x3da0,0x3ca0,0x3c20,0x3b80,0x3b00,0x3ae0,0x3a90,0x3ae0,0x3b10,0x3b80,0x3c20,0x3cb0,0x3df0,0x36d0,0x3370,0x3540,0x3520,0x3640,0x3660,0x36c0,0x3640,0x36a0,0x3640,0x35c0,0x3580,0x34c0,0x37c0,0x3ca0,0x3c60,0x3bf0,0x3b60,0x3b40,0x3b40,0x3af0,0x3b50,0x3af0,0x3b60,0x3b80,0x3c20,0x3bf0,0x3b00,0x3b10,0x3b70,0x3b90,0x3bb0,0x3ba0,0x3bb0,0x3ba0,0x3b90,0x3be0,0x3b80,0x3b50,0x3ab0,0x3d10,0x3f10,0x3e70,0x3e70,0x3e10,0x3e40,0x3e10,0x3e00,0x3e40,0x3e50,0x3e40,0x3e50,0x3e50,0x3e70,0x3d80,0x3d00,0x3d30,0x3d40,0x3da0,0x3d60,0x3d50,0x3d10,0x3d30,0x3cf0,0x3cf0,
-0x3d00,0x3cf0,0x3c80,0x3ba0,0x3b80,0x3b70,0x3b60,0x3b20,0x3b50,0x3b30,0x3b40,0x3b50,0x3be0,0x3c20,0x3ce0,0x3ab0,0x3460,0x33e0,0x3440,0x3490,0x3490,0x3480,0x3500,0x3520,0x3520,0x34d0,0x3500,0x34d0,0x3530,0x3430,0x3410,0x3430,0x3470,0x3470,0x34c0,0x3460,0x34a0,0x3400,0x3450,0x33b0,0x33b0,0x3210,0x33f0,0x3df0,0x3e10,0x3d60,0x3d20,0x3c80,0x3cf0,0x3ca0,0x3cc0,0x3cb0,0x3cf0,0x3ce0,0x3d50,0x3d60,0x3d40,0x3d10,0x3d20,0x3d40,0x3d50,0x3d30,0x3da0,0x3d40,0x3da0,0x3d90,0x3dc0,0x3dc0,0x3d90,0x3d90,0x3ca0,0x3c60,0x3cf0,0x3c40,0x3c90,0x3cd0,0x3c80,0x3c70,0x3c70,0x3c80,0x3bc0,0x3bb0,0x3bf0,0x3cc0,0x3d40,0x3d00,0x3ca0,0x3c60,0x3c30,0x3cb0,0x3c20,0x3c80,0x3c10,0x3d90,0x3d20,0x3f60,0x3bb0,0x3300,0x3410,0x3450,0x3560,0x3560,0x3640,0x3600,0x35b0,0x35e0,0x3540,0x3500,0x3440,0x32d0,0x3a60,0x3fd0,0x3d40,0x3d70,0x3c60,0x3cb0,0x3bd0,0x3c00,0x3c20,0x3c50,0x3c10,0x3cc0,0x3c60,0x3c70,0x3c20,0x3b90,0x3c20,0x3c10,0x3c30,0x3b90,0x3c00,0x3bf0,0x3c40,0x3bd0,0x3cd0,0x3c10,0x3e20,0x38d0,0x3220,0x3490,0x3410,0x3480,0x34a0,0x34a0,0x34f0,0x34c0,0x3490,0x3500,0x3480,0x3480,0x3460,0x3590,0x3560,0x3590,0x3590,0x3560,0x35a0,0x3580,0x35a0,0x34f0,0x34c0,0x34c0,0x3480,0x3400,0x3ba0,0x3d40,0x3c10,0x3ce0,0x3c00,0x3ba0,0x3ba0,0x3b80,0x3b80,0x3c30,0x3bf0,0x3c20,0x3c10,0x3c10,0x3970,0x3a70,0x3a50,0x3a10,0x3a20,0x3a00,0x3aa0,0x3a80,0x3aa0,0x3a20,0x3aa0,0x3aa0,0x3b80,0x3820,0x3560,0x3600,0x3580,0x3640,0x3660,0x35d0,0x3660,0x3620,0x3610,
-0x3590,0x3550,0x3590,0x3500,0x3560,0x3560,0x3520,0x3510,0x3500,0x3560,0x3560,0x3490,0x34a0,0x34e0,0x3530,0x3550,0x3570,0x3370,0x3220,0x32c0,0x3260,0x32c0,0x32b0,0x32a0,0x32f0,0x3380,0x3380,0x3310,0x3350,0x3320,0x3350,0x34e0,0x34c0,0x3500,0x3490,0x34a0,0x3510,0x34a0,0x3460,0x3410,0x3420,0x33d0,0x33c0,0x3310,0x3800,0x3a10,0x38b0,0x3940,0x3870,0x3840,0x3850,0x3830,0x3860,0x38a0,0x3890,0x38d0,0x3a50,0x3860,0x3230,0x32a0,0x3320,0x3350,0x33b0,0x33a0,0x33d0,0x33d0,0x3420,0x3410,0x3480,0x33b0,0x33a0,0x33a0,0x3450,0x3480,0x3460,0x33d0,0x3400,0x3400,0x33d0,0x33f0,0x33d0,0x3330,0x3360,0x32d0,0x3450,0x39b0,0x3a90,0x39a0,0x39b0,0x3960,0x3970,0x3960,0x39f0,0x3990,0x3a10,0x3a40,0x3ad0,0x3ad0,0x34d0,0x3410,0x3590,0x3570,0x3640,0x3630,0x35f0,0x3600,0x35c0,0x3590,0x3580,0x35d0,0x3440,0x36a0,0x3c00,0x3ae0,0x3ab0,0x3a30,0x3a10,0x3a70,0x3aa0,0x3a80,0x3a90,0x3a90,0x3a40,0x3a60,0x3a00,0x39c0,0x3940,0x3990,0x3940,0x39c0,0x3920,0x3920,0x3940,0x3970,0x3920,0x39d0,0x3960,0x3960,0x3980,0x3550,0x35c0,0x35f0,0x3550,0x35c0,0x35b0,0x35e0,0x35a0,0x3610,0x35a0,0x3570,0x3580,0x3590,0x3490,0x33f0,0x33f0,0x33e0,0x3420,0x33d0,0x33b0,0x33e0,0x3420,0x33d0,0x33e0,0x3440,0x3420,0x33d0,0x3430,0x33e0,0x3420,0x3420,0x3490,0x3460,0x3470,0x3460,0x3470,0x3480,0x33f0,0x33b0,0x33a0,0x3950,0x3b10,0x39b0,0x39e0,0x3960,0x39b0,0x39a0,0x3940,0x39b0,0x3970,0x39e0,0x39f0,0x3b50,0x3950,0x3420,0x34d0,0x3560,0x3590,0x3600,0x3600,0x35f0,0x35c0,
-0x35c0,0x35e0,0x3550,0x34f0,0x3430,0x3820,0x3a90,0x38d0,0x3990,0x38c0,0x38b0,0x3870,0x38d0,0x38d0,0x38e0,0x3950,0x3920,0x3a30,0x36e0,0x34b0,0x3560,0x3520,0x3590,0x3550,0x3600,0x35f0,0x3590,0x3560,0x35a0,0x35d0,0x3540,0x3590,0x37c0,0x3790,0x3720,0x3720,0x3770,0x37a0,0x3740,0x3790,0x36f0,0x37a0,0x3700,0x3740,0x3640,0x38d0,0x3b90,0x3ac0,0x3ad0,0x3ab0,0x3a60,0x3a80,0x3a10,0x3a20,0x3a60,0x3a50,0x3ac0,0x3ae0,0x3c20,0x36e0,0x3570,0x36e0,0x3640,0x36d0,0x36a0,0x3720,0x3710,0x3740,0x3700,0x36c0,0x3660,0x35a0,0x37f0,0x3bb0,0x3ae0,0x3a90,0x3aa0,0x3a50,0x3a30,0x3a40,0x3a90,0x3a20,0x3aa0,0x3a40,0x3b80,0x3a20,0x3590,0x3550,0x35f0,0x3620,0x3650,0x3640,0x3680,0x3660,0x3630,0x3630,0x3600,0x35d0,0x3530,0x3880,0x3a60,0x3990,0x39c0,0x3910,0x39a0,0x3920,0x3980,0x3920,0x3930,0x3970,0x39a0,0x3960,0x3960,0x39e0,0x3a30,0x3a30,0x39e0,0x39e0,0x39a0,0x39f0,0x3980,0x3a30,0x39d0,0x3a40,0x3a10,0x3ac0,0x38d0,0x3580,0x3660,0x3630,0x3670,0x3680,0x36a0,0x3680,0x3690,0x3640,0x3660,0x3630,0x3630,0x35f0,0x3710,0x37e0,0x3740,0x3740,0x3770,0x3770,0x3740,0x3760,0x3790,0x3770,0x3700,0x3710,0x36c0,0x3950,0x3a10,0x39e0,0x39c0,0x3960,0x3990,0x39e0,0x39a0,0x3980,0x3970,0x39c0,0x39f0,0x3a90,0x39c0,0x36c0,0x3740,0x3740,0x3750,0x37c0,0x37c0,0x37a0,0x37b0,0x37a0,0x37c0,0x3760,0x3780,0x3730,0x38d0,0x3ab0,0x39e0,0x3a60,0x39c0,0x3a00,0x39e0,0x3a00,0x3a00,0x3a30,0x3a20,0x3a00,0x3a00,0x39f0,0x3b40,0x3b50,0x3b20,0x3b40,0x3b40,0x3b40,0x3b20,
-0x3b10,0x3b40,0x3b20,0x3b60,0x3b80,0x3b60,0x3b00,0x3a80,0x3ac0,0x3af0,0x3ad0,0x3ae0,0x3af0,0x3af0,0x3b00,0x3ab0,0x3ae0,0x3ab0,0x3ab0,0x3b00,0x3b70,0x3b50,0x3b60,0x3b60,0x3b40,0x3b10,0x3b40,0x3b50,0x3b30,0x3b30,0x3b00,0x3b10,0x3af0,0x3ae0,0x3ac0,0x3ac0,0x3a90,0x3ac0,0x3a90,0x3ac0,0x3a70,0x3ab0,0x3a90,0x3ae0,0x3a70,0x3b40,0x3a70,0x3620,0x3660,0x3690,0x36b0,0x36b0,0x36b0,0x36b0,0x36b0,0x3690,0x3680,0x3650,0x3670,0x3590,0x3780,0x39e0,0x38c0,0x3900,0x38b0,0x38b0,0x3890,0x3870,0x3890,0x3890,0x38b0,0x38c0,0x3920,0x3800,0x3530,0x3570,0x3580,0x3580,0x35a0,0x3590,0x35c0,0x35c0,0x35c0,0x35a0,0x3600,0x35e0,0x35c0,0x35d0,0x35e0,0x35e0,0x3620,0x35e0,0x3610,0x3600,0x3640,0x35e0,0x3620,0x35a0,0x3600,0x3520,0x3700,0x3ae0,0x3a00,0x3a40,0x39e0,0x3a10,0x39f0,0x3a00,0x39f0,0x3a00,0x3a00,0x3a00,0x3a40,0x3a50,0x39a0,0x3910,0x3970,0x3940,0x3990,0x3930,0x3980,0x3950,0x3960,0x3970,0x39b0,0x3980,0x39b0,0x3970,0x3770,0x3780,0x37b0,0x3770,0x37a0,0x3790,0x37b0,0x37b0,0x37a0,0x3770,0x3750,0x3750,0x3700,0x3800,0x3930,0x38c0,0x38e0,0x3880,0x3880,0x38a0,0x3860,0x38a0,0x3880,0x38a0,0x3870,0x3910,0x3760,0x3560,0x35c0,0x35c0,0x35c0,0x35f0,0x35f0,0x35a0,0x35c0,0x35b0,0x35b0,0x35b0,0x3590,0x3580,0x3540,0x3530,0x3520,0x3510,0x3510,0x3510,0x3510,0x3520,0x3500,0x3520,0x3510,0x3500,0x3520,0x3530,0x3560,0x3560,0x3560,0x3560,0x3560,0x3560,0x3550,0x3550,0x3550,0x3570,0x3580,0x3570,0x3580,0x3570,0x3580,0x3580,0x3590,0x35c0,0x35d0,
-0x35b0,0x35d0,0x3590,0x35a0,0x3590,0x35c0,0x3590,0x35e0,0x3820,0x3850,0x3810,0x3820,0x37f0,0x3810,0x3810,0x3810,0x3820,0x3830,0x3830,0x3830,0x3870,0x3800,0x3780,0x37c0,0x37c0,0x37e0,0x37d0,0x37e0,0x37f0,0x37d0,0x37d0,0x37b0,0x3800,0x3740,0x3890,0x39f0,0x3980,0x39c0,0x3990,0x3970,0x3960,0x3960,0x3970,0x3980,0x3990,0x3980,0x39d0,0x3a20,0x3730,0x3680,0x3710,0x36f0,0x36f0,0x36f0,0x3750,0x3730,0x3700,0x3710,0x3700,0x3700,0x36a0,0x3750,0x3a00,0x39c0,0x39c0,0x39b0,0x39b0,0x3990,0x3970,0x3990,0x3970,0x39a0,0x39a0,0x39c0,0x39b0,0x3a00,0x3a10,0x3a20,0x39f0,0x3a00,0x3a10,0x3a00,0x3a10,0x3a20,0x3a00,0x3a20,0x39f0,0x3a10,0x39f0,0x39b0,0x39b0,0x39b0,0x39b0,0x39b0,0x39a0,0x39c0,0x39b0,0x39a0,0x3980,0x3990,0x3980,0x3980,0x39a0,0x3980,0x3940,0x3930,0x3950,0x3920,0x3930,0x3910,0x3970,0x3930,0x3960,0x3920,0x39a0,0x3820,0x35c0,0x3660,0x3630,0x3660,0x3650,0x3670,0x3670,0x3660,0x3660,0x3660,0x3660,0x3640,0x3610,0x3680,0x36a0,0x3680,0x36d0,0x3690,0x36a0,0x3690,0x36a0,0x3680,0x3680,0x3670,0x36b0,0x3680,0x36f0,0x38a0,0x3880,0x3880,0x38a0,0x38a0,0x38b0,0x3890,0x38a0,0x38a0,0x3890,0x38c0,0x38a0,0x38d0,0x39d0,0x39f0,0x39f0,0x39f0,0x39f0,0x39f0,0x39f0,0x3a00,0x39e0,0x39f0,0x39f0,0x39f0,0x39e0,0x3980,0x3930,0x3970,0x3950,0x3930,0x3920,0x3930,0x3900,0x3930,0x3910,0x3950,0x3920,0x3960,0x3970,0x36a0,0x3640,0x36a0,0x3690,0x3690,0x3690,0x36d0,0x36c0,0x3690,0x36c0,0x3690,0x36b0,0x3630,0x3710,0x3920,0x38b0,0x38d0,0x38b0,
-0x38a0,0x3870,0x3880,0x3890,0x3880,0x38a0,0x38a0,0x38c0,0x38e0,0x38e0,0x38e0,0x38f0,0x38e0,0x38d0,0x38f0,0x3910,0x3900,0x3900,0x38d0,0x38f0,0x38f0,0x3900,0x38d0,0x38c0,0x38c0,0x38c0,0x38d0,0x38c0,0x38d0,0x38a0,0x38e0,0x38d0,0x38f0,0x38c0,0x38f0,0x38d0,0x3780,0x3790,0x3780,0x3780,0x37b0,0x3770,0x37a0,0x37a0,0x3790,0x3790,0x3760,0x3790,0x36e0,0x3830,0x39a0,0x3910,0x3950,0x3920,0x3910,0x3910,0x3900,0x3900,0x38e0,0x3910,0x3930,0x3930,0x3970,0x36d0,0x3610,0x3680,0x3640,0x3680,0x3670,0x36b0,0x3680,0x36a0,0x3680,0x36a0,0x3690,0x3670,0x3680,0x36c0,0x36b0,0x36b0,0x36a0,0x36b0,0x36a0,0x36b0,0x36c0,0x36b0,0x36d0,0x36a0,0x36b0,0x36e0,0x37a0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x37e0,0x37d0,0x37e0,0x37b0,0x3930,0x39c0,0x3980,0x39b0,0x39a0,0x39a0,0x3970,0x39c0,0x3970,0x39a0,0x3990,0x39b0,0x3980,0x3980,0x39d0,0x39c0,0x39b0,0x39b0,0x39b0,0x3990,0x39d0,0x39a0,0x39b0,0x39b0,0x39e0,0x39c0,0x3a50,0x38e0,0x3750,0x37b0,0x37a0,0x37d0,0x37c0,0x37c0,0x37d0,0x37e0,0x37b0,0x37b0,0x37b0,0x37a0,0x37c0,0x3920,0x3970,0x3950,0x3960,0x3950,0x3970,0x3950,0x3940,0x3910,0x3940,0x3940,0x3940,0x3930,0x3950,0x3990,0x3990,0x3960,0x3960,0x3950,0x3970,0x3940,0x3980,0x3970,0x3990,0x3950,0x39c0,0x38f0,0x3680,0x36d0,0x36f0,0x3710,0x3730,0x3710,0x3720,0x3710,0x3700,0x3710,0x36f0,0x3710,0x3680,0x3850,0x3990,0x38f0,0x3930,0x3910,0x3920,0x3900,0x3910,0x38f0,0x3900,0x3900,0x3900,0x3920,0x3930,0x3860,0x3860,0x3870,
-0x3850,0x3870,0x3850,0x3880,0x3860,0x3870,0x3840,0x3870,0x3860,0x3860,0x37f0,0x3760,0x3770,0x3740,0x3760,0x3760,0x3750,0x3760,0x3770,0x3790,0x3780,0x3750,0x3750,0x3730,0x36e0,0x36e0,0x36c0,0x36d0,0x36c0,0x36d0,0x36f0,0x36b0,0x36e0,0x36e0,0x36b0,0x36b0,0x36d0,0x3660,0x3650,0x3680,0x3670,0x36a0,0x3670,0x3690,0x3670,0x3680,0x3660,0x3680,0x36a0,0x3680,0x3680,0x36a0,0x36b0,0x36c0,0x36f0,0x36c0,0x36b0,0x36c0,0x36c0,0x36a0,0x36c0,0x36a0,0x36d0,0x3690,0x37b0,0x38a0,0x3830,0x3870,0x3870,0x3860,0x3850,0x3840,0x3870,0x3860,0x3870,0x38b0,0x38a0,0x38a0,0x37c0,0x3780,0x37b0,0x3790,0x37f0,0x3800,0x3800,0x37f0,0x37f0,0x37c0,0x37d0,0x37a0,0x37b0,0x38d0,0x3920,0x3910,0x3930,0x38e0,0x38c0,0x38d0,0x38b0,0x38e0,0x38d0,0x3920,0x38e0,0x3970,0x3840,0x36a0,0x3730,0x36f0,0x36f0,0x3720,0x3710,0x36f0,0x3750,0x3740,0x3720,0x3700,0x3720,0x36c0,0x38a0,0x3970,0x3900,0x3940,0x38f0,0x3940,0x38f0,0x3910,0x38d0,0x3900,0x3900,0x3900,0x3900,0x3930,0x3950,0x3950,0x3940,0x3960,0x3930,0x3940,0x3960,0x3960,0x3990,0x3960,0x3970,0x3960,0x39a0,0x3810,0x36d0,0x3720,0x3710,0x3730,0x3720,0x3730,0x3720,0x3710,0x3700,0x36d0,0x3740,0x36c0,0x37c0,0x38e0,0x38d0,0x38c0,0x3890,0x38a0,0x38b0,0x3870,0x38a0,0x3890,0x3890,0x38a0,0x38c0,0x38f0,0x3720,0x3700,0x3730,0x3710,0x3730,0x3720,0x3770,0x3730,0x3710,0x3760,0x3720,0x3710,0x36e0,0x3750,0x3870,0x3800,0x37f0,0x3810,0x3800,0x3810,0x3800,0x3810,0x3810,0x3810,0x3830,0x3820,0x3860,0x3720,0x3680,
-0x36c0,0x36a0,0x36c0,0x3680,0x36a0,0x36b0,0x36c0,0x36b0,0x36c0,0x3690,0x36b0,0x36e0,0x36c0,0x36b0,0x36e0,0x36a0,0x3700,0x36d0,0x36e0,0x36c0,0x36e0,0x36c0,0x3700,0x36b0,0x36b0,0x38b0,0x38a0,0x38a0,0x3890,0x3880,0x3870,0x3860,0x3890,0x3890,0x3880,0x38d0,0x3890,0x3910,0x37f0,0x36f0,0x3760,0x3740,0x3770,0x3770,0x3780,0x3780,0x3780,0x3780,0x3780,0x3770,0x3780,0x3750,0x38e0,0x3960,0x3910,0x3930,0x3920,0x3950,0x3920,0x3920,0x3920,0x3930,0x3930,0x3930,0x3950,0x3950,0x3940,0x3950,0x3940,0x3960,0x3960,0x3980,0x3970,0x3970,0x3960,0x3960,0x3970,0x3970,0x3960,0x3980,0x39b0,0x3990,0x3980,0x3990,0x3980,0x3970,0x39a0,0x39a0,0x39a0,0x3990,0x39b0,0x3980,0x3970,0x3960,0x3960,0x3950,0x3960,0x3950,0x3970,0x3930,0x3930,0x3940,0x3930,0x3920,0x3920,0x3950,0x38b0,0x38c0,0x38d0,0x38c0,0x38d0,0x38c0,0x38d0,0x38c0,0x38c0,0x38b0,0x38a0,0x38b0,0x3880,0x3890,0x38b0,0x38d0,0x38b0,0x38a0,0x38a0,0x3880,0x38a0,0x3890,0x38b0,0x3890,0x38a0,0x3890,0x38c0,0x37b0,0x3730,0x3750,0x3740,0x3770,0x3760,0x3770,0x3750,0x3770,0x3750,0x3770,0x3770,0x3760,0x3740,0x3700,0x3700,0x3710,0x3710,0x3720,0x36f0,0x3730,0x36f0,0x3710,0x3700,0x3720,0x36e0,0x3760,0x38e0,0x38c0,0x38b0,0x38b0,0x38b0,0x3890,0x3890,0x38b0,0x38a0,0x3890,0x38b0,0x38b0,0x38d0,0x37c0,0x36e0,0x3760,0x3710,0x3740,0x3760,0x3760,0x3770,0x3790,0x3750,0x3750,0x3750,0x3740,0x3750,0x3720,0x3720,0x3720,0x3730,0x3730,0x3730,0x3720,0x3740,0x3720,0x3740,0x3740,0x3730,0x3700,0x3780,
-0x38b0,0x3880,0x3880,0x3870,0x3880,0x3870,0x3860,0x3880,0x3870,0x3870,0x3880,0x3870,0x3870,0x38a0,0x38b0,0x3890,0x38b0,0x3890,0x38b0,0x38a0,0x3890,0x38a0,0x38b0,0x38c0,0x38b0,0x38f0,0x37a0,0x3740,0x3780,0x3780,0x3790,0x3770,0x3790,0x37a0,0x3780,0x3770,0x3760,0x3770,0x3730,0x3790,0x3900,0x38d0,0x38c0,0x38c0,0x38c0,0x38c0,0x38b0,0x38b0,0x38c0,0x38b0,0x38a0,0x38d0,0x38c0,0x38a0,0x3870,0x3870,0x3860,0x3870,0x3870,0x3860,0x3870,0x3870,0x3860,0x3860,0x3850,0x3870,0x3860,0x3790,0x3750,0x3780,0x3770,0x3760,0x3770,0x3780,0x3760,0x3750,0x3750,0x3760,0x3740,0x3750,0x3750,0x3730,0x3720,0x3740,0x3740,0x3730,0x3740,0x3740,0x3720,0x3720,0x3730,0x3710,0x3730,0x3710,0x36e0,0x36d0,0x36e0,0x36e0,0x36e0,0x36d0,0x36d0,0x36f0,0x36e0,0x36d0,0x36d0,0x36d0,0x36e0,0x36e0,0x36f0,0x36f0,0x36f0,0x36e0,0x36e0,0x36e0,0x36f0,0x36e0,0x36d0,0x36e0,0x36d0,0x36d0,0x36d0,0x36d0,0x36d0,0x36e0,0x36d0,0x36e0,0x36d0,0x36d0,0x36e0,0x36e0,0x36e0,0x36f0,0x36f0,0x36f0,0x3700,0x3730,0x3730,0x3720,0x3720,0x3730,0x3740,0x3720,0x3730,0x3730,0x3730,0x3740,0x3730,0x3740,0x37b0,0x37c0,0x37c0,0x37d0,0x37c0,0x37c0,0x37d0,0x37d0,0x37c0,0x37c0,0x37d0,0x37c0,0x37c0,0x38c0,0x38f0,0x38d0,0x38e0,0x38f0,0x38e0,0x38e0,0x38f0,0x38d0,0x38e0,0x38f0,0x38f0,0x38e0,0x38f0,0x38e0,0x38f0,0x38e0,0x38f0,0x38e0,0x38e0,0x38d0,0x38e0,0x38f0,0x38e0,0x38f0,0x38e0,0x38f0,0x38c0,0x38a0,0x38b0,0x38a0,0x38b0,0x38a0,0x38b0,0x38a0,0x38b0,0x38a0,0x38b0,0x38a0,0x38a0,
-0x38a0,0x3820,0x3840,0x3820,0x3810,0x3810,0x3810,0x3820,0x3820,0x3810,0x3820,0x3820,0x3820,0x3810,0x37b0,0x3790,0x37a0,0x37b0,0x37b0,0x37b0,0x37a0,0x37a0,0x37a0,0x3790,0x3790,0x37a0,0x3760,0x37e0,0x3850,0x3840,0x3850,0x3830,0x3840,0x3840,0x3840,0x3830,0x3840,0x3850,0x3850,0x3860,0x3870,0x3790,0x3770,0x3780,0x3780,0x37b0,0x37b0,0x37a0,0x37a0,0x3790,0x37a0,0x3790,0x3790,0x3770,0x37c0,0x38f0,0x38f0,0x38e0,0x38d0,0x38d0,0x38c0,0x38c0,0x38d0,0x38b0,0x38c0,0x38d0,0x38d0,0x38e0,0x38c0,0x38a0,0x38b0,0x38a0,0x38c0,0x38b0,0x38d0,0x38c0,0x38c0,0x38c0,0x38c0,0x38d0,0x38b0,0x38d0,0x3900,0x3900,0x38f0,0x38f0,0x38f0,0x38f0,0x38f0,0x3900,0x38e0,0x3900,0x3900,0x3900,0x38f0,0x38e0,0x38f0,0x38e0,0x3900,0x38f0,0x38e0,0x38f0,0x3900,0x38e0,0x38f0,0x38e0,0x38d0,0x38c0,0x38c0,0x38d0,0x38c0,0x38d0,0x38c0,0x38d0,0x38b0,0x38b0,0x38b0,0x38a0,0x38b0,0x38b0,0x38b0,0x38b0,0x38a0,0x38a0,0x38a0,0x3890,0x3890,0x3890,0x38a0,0x38a0,0x38b0,0x38a0,0x38d0,0x38a0,0x38d0,0x3880,0x3780,0x3790,0x37a0,0x37a0,0x37c0,0x37b0,0x37a0,0x37a0,0x37b0,0x3790,0x37b0,0x3770,0x3790,0x3880,0x38a0,0x3880,0x3880,0x3870,0x3880,0x3890,0x3880,0x3870,0x3890,0x3890,0x3880,0x38d0,0x3810,0x37a0,0x37c0,0x37b0,0x37c0,0x37c0,0x37c0,0x37c0,0x37e0,0x37c0,0x37c0,0x37c0,0x37b0,0x37c0,0x3860,0x3850,0x3850,0x3860,0x3850,0x3870,0x3860,0x3870,0x3840,0x3870,0x3850,0x3860,0x3840,0x3870,0x38b0,0x38a0,0x38a0,0x3890,0x3880,0x3890,0x3890,0x38a0,0x3890,0x3890,0x3880,
-0x3870,0x38c0,0x37a0,0x3720,0x3760,0x3740,0x3760,0x3770,0x3760,0x3750,0x3760,0x3770,0x3770,0x3770,0x3760,0x3760,0x3760,0x3760,0x3760,0x3750,0x3750,0x3740,0x3730,0x3740,0x3740,0x3740,0x3760,0x3750,0x3760,0x37b0,0x37a0,0x37c0,0x37a0,0x37a0,0x37b0,0x37a0,0x37b0,0x37a0,0x37a0,0x37b0,0x37b0,0x3790,0x3810,0x3850,0x3830,0x3840,0x3840,0x3830,0x3850,0x3850,0x3850,0x3840,0x3850,0x3860,0x3850,0x3860,0x3850,0x3850,0x3830,0x3840,0x3850,0x3850,0x3840,0x3860,0x3850,0x3830,0x3840,0x3830,0x3850,0x3840,0x3840,0x3850,0x3850,0x3840,0x3850,0x3860,0x3850,0x3840,0x3850,0x3840,0x3840,0x3830,0x3840,0x3880,0x3880,0x3890,0x3870,0x3890,0x3880,0x3870,0x3880,0x3880,0x3890,0x3880,0x3880,0x3890,0x37e0,0x3790,0x37a0,0x3780,0x3790,0x3780,0x37a0,0x3780,0x37a0,0x3790,0x37a0,0x3790,0x37a0,0x3790,0x3760,0x3770,0x3760,0x3770,0x3760,0x3770,0x3770,0x3770,0x3760,0x3770,0x3760,0x3780,0x3740,0x37e0,0x38c0,0x3890,0x3890,0x3890,0x38a0,0x3880,0x3880,0x3880,0x38a0,0x3890,0x3880,0x3890,0x3890,0x3870,0x3860,0x3860,0x3850,0x3860,0x3860,0x3880,0x3870,0x3870,0x3880,0x3880,0x3860,0x3870,0x3850,0x37e0,0x37e0,0x37d0,0x37d0,0x37d0,0x37c0,0x37d0,0x37d0,0x37d0,0x37e0,0x37c0,0x37d0,0x37b0,0x3750,0x3750,0x3740,0x3750,0x3750,0x3750,0x3750,0x3730,0x3760,0x3750,0x3740,0x3750,0x3720,0x3770,0x3770,0x3790,0x3790,0x3790,0x3790,0x3780,0x3780,0x3780,0x3780,0x3780,0x3790,0x3790,0x3790,0x3760,0x3770,0x3760,0x3760,0x3760,0x3770,0x3770,0x3770,0x3760,0x3770,
-0x3780,0x3770,0x3750,0x37f0,0x38b0,0x3890,0x38a0,0x3870,0x3890,0x3890,0x3880,0x3890,0x3880,0x3890,0x3880,0x3890,0x3890,0x3880,0x3880,0x3880,0x3880,0x3880,0x3870,0x3880,0x3890,0x3880,0x3880,0x3880,0x3880,0x38a0,0x37c0,0x3780,0x3790,0x3790,0x37a0,0x3790,0x3790,0x37a0,0x3790,0x3780,0x3780,0x3780,0x3760,0x3790,0x3860,0x3840,0x3840,0x3840,0x3810,0x3820,0x3810,0x3830,0x3830,0x3830,0x3830,0x3830,0x3860,0x37c0,0x3760,0x3790,0x3780,0x37a0,0x37a0,0x37c0,0x37a0,0x37a0,0x3790,0x3790,0x3790,0x3780,0x3790,0x3840,0x3860,0x3840,0x3850,0x3830,0x3840,0x3830,0x3830,0x3830,0x3840,0x3840,0x3840,0x3850,0x3800,0x37a0,0x37c0,0x37b0,0x37c0,0x37b0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37d0,0x37b0,0x37a0,0x37a0,0x3790,0x37a0,0x37a0,0x37a0,0x37b0,0x37b0,0x37a0,0x37b0,0x37b0,0x37b0,0x3790,0x3830,0x3880,0x3870,0x3870,0x3850,0x3860,0x3860,0x3870,0x3870,0x3870,0x3860,0x3870,0x3870,0x3880,0x3870,0x3870,0x3870,0x3870,0x3890,0x3880,0x3880,0x3870,0x3880,0x3880,0x3880,0x3880,0x3880,0x3890,0x38b0,0x38a0,0x38a0,0x38a0,0x3890,0x38a0,0x3890,0x38a0,0x38a0,0x3890,0x38a0,0x38a0,0x3890,0x3860,0x3850,0x3860,0x3860,0x3860,0x3860,0x3860,0x3850,0x3860,0x3850,0x3850,0x3840,0x3850,0x3850,0x3860,0x3860,0x3850,0x3850,0x3850,0x3840,0x3830,0x3840,0x3830,0x3850,0x3830,0x3860,0x3810,0x3790,0x37b0,0x37a0,0x37b0,0x37a0,0x37b0,0x37b0,0x37a0,0x37b0,0x37a0,0x37a0,0x37a0,0x3790,0x37a0,0x37a0,0x37a0,0x3790,0x3790,0x3790,0x3790,0x37a0,0x37a0,
-0x3790,0x37a0,0x37a0,0x3790,0x37a0,0x3790,0x37a0,0x37a0,0x37a0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37a0,0x37a0,0x37a0,0x37b0,0x3840,0x3860,0x3850,0x3860,0x3850,0x3850,0x3850,0x3860,0x3850,0x3850,0x3860,0x3850,0x3860,0x3870,0x3860,0x3860,0x3860,0x3860,0x3860,0x3870,0x3870,0x3870,0x3860,0x3860,0x3870,0x3870,0x3870,0x3860,0x3870,0x3870,0x3860,0x3860,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x38a0,0x3890,0x3890,0x3890,0x3890,0x3890,0x3890,0x3880,0x3890,0x3890,0x3890,0x3890,0x3890,0x3880,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3880,0x3880,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3870,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3890,0x3890,0x3890,0x3890,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3880,0x3870,0x3860,0x3850,0x3850,0x3850,0x3850,0x3840,0x3850,0x3840,0x3850,0x3850,0x3860,0x3850,0x3860,0x3830,0x3790,0x37a0,0x37a0,0x37a0,0x37a0,0x37b0,0x37b0,0x37b0,0x37b0,0x37a0,0x37a0,0x37a0,0x37a0,0x3820,0x3870,0x3850,0x3860,0x3850,0x3850,0x3840,0x3850,0x3840,0x3850,0x3850,0x3850,0x3870,0x3820,0x37f0,0x3810,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x3800,0x3810,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3840,0x3850,0x3850,0x3840,0x3840,0x3850,0x3840,0x3850,0x3870,0x3870,0x3860,0x3860,0x3860,0x3860,0x3860,
-0x3860,0x3860,0x3860,0x3860,0x3860,0x3870,0x37f0,0x37c0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37d0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37e0,0x37c0,0x37f0,0x3860,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3850,0x3860,0x3860,0x3850,0x3850,0x3850,0x3850,0x3860,0x3850,0x3850,0x3850,0x3860,0x3850,0x3850,0x3850,0x3850,0x3850,0x3840,0x3840,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3840,0x3830,0x3840,0x3820,0x3840,0x37f0,0x3780,0x37a0,0x3790,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x3790,0x37a0,0x37a0,0x37a0,0x37b0,0x37b0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x3780,0x3820,0x3850,0x3830,0x3840,0x3830,0x3840,0x3830,0x3840,0x3830,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3850,0x3840,0x3840,0x3840,0x3840,0x3840,0x3840,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3820,0x3820,0x3820,0x3830,0x3830,0x3840,0x3810,0x37a0,0x37b0,0x37a0,0x37b0,0x37b0,0x37c0,0x37c0,0x37b0,0x37b0,0x37b0,0x37a0,0x37b0,0x3790,0x37e0,0x3830,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3820,0x3810,0x3820,0x3810,0x3840,0x3810,0x37a0,0x37b0,0x37b0,0x37c0,0x37c0,0x37c0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37a0,0x3830,0x3860,0x3840,0x3850,0x3840,0x3850,0x3840,0x3840,0x3840,0x3840,0x3840,0x3850,0x3850,0x3840,0x3820,0x3820,0x3830,0x3830,0x3820,0x3820,
-0x3830,0x3830,0x3820,0x3820,0x3830,0x3830,0x3830,0x3800,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37f0,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x37d0,0x37c0,0x37c0,0x37b0,0x37c0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37d0,0x37e0,0x37d0,0x3800,0x3820,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x37f0,0x37b0,0x37b0,0x37b0,0x37a0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37a0,0x37a0,0x37a0,0x3790,0x37a0,0x37a0,0x3790,0x37a0,0x3790,0x3790,0x3790,0x3790,0x3790,0x3790,0x3790,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x37a0,0x3790,0x37b0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x37b0,0x37b0,0x37b0,0x37b0,0x37c0,0x37b0,0x37c0,0x37b0,0x37c0,0x37b0,0x37c0,0x37b0,0x37b0,0x3830,0x3830,0x3830,0x3830,0x3820,0x3820,0x3830,0x3830,0x3830,0x3820,0x3830,0x3830,0x3840,0x3800,0x37a0,0x37c0,0x37b0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37b0,0x37b0,0x37b0,0x37b0,0x37c0,0x37b0,
-0x37b0,0x37b0,0x37b0,0x37b0,0x37c0,0x37b0,0x37b0,0x37b0,0x37b0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3820,0x3820,0x3820,0x3820,0x3830,0x37f0,0x37b0,0x37d0,0x37c0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x37d0,0x3830,0x3840,0x3830,0x3830,0x3830,0x3830,0x3820,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x3820,0x3820,0x3810,0x3820,0x3820,0x3820,0x37e0,0x37c0,0x37d0,0x37c0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37b0,0x37e0,0x3810,0x3800,0x3810,0x3800,0x3810,0x3810,0x3800,0x3800,0x3810,0x3800,0x3810,0x3800,0x3810,0x3800,0x3810,0x3810,0x3810,0x3800,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x37e0,0x37c0,0x37d0,0x37c0,0x37d0,0x37c0,0x37d0,0x37c0,0x37d0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37b0,0x37c0,0x37b0,0x37b0,0x37c0,0x37c0,0x37b0,0x37c0,0x37d0,0x37c0,0x37d0,
-0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x3810,0x3820,0x3810,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3830,0x3820,0x3830,0x3810,0x37d0,0x37e0,0x37d0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37d0,0x37c0,0x3800,0x3830,0x3810,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3820,0x3820,0x3820,0x3830,0x3820,0x3820,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3830,0x3820,0x3820,0x3830,0x3820,0x3830,0x37e0,0x37d0,0x37e0,0x37d0,0x37e0,0x37d0,0x37e0,0x37e0,0x37e0,0x37d0,0x37e0,0x37e0,0x37e0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x3800,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,
-0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37d0,0x37c0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37d0,0x37c0,0x37c0,0x37c0,0x37d0,0x37d0,0x37d0,0x37c0,0x37c0,0x37c0,0x37c0,0x37c0,0x37d0,0x37c0,0x37f0,0x3800,0x37f0,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3830,0x3820,0x3810,0x3810,0x3810,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3830,0x3830,0x3830,0x3830,0x3820,0x3830,0x3820,0x3830,0x3820,0x3830,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x37e0,0x37d0,0x37e0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37d0,0x37d0,0x37d0,0x37d0,0x37d0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3820,0x3820,0x3810,0x3820,0x37f0,
-0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x3800,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x3820,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x3820,0x3820,0x3820,0x3820,0x3820,0x3810,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37f0,0x37e0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37f0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37e0,0x37e0,0x37e0,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x37f0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,
-0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37f0,0x37f0,0x37f0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x37e0,0x37e0,0x37f0,0x37e0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37f0,0x3810,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x3800,0x3800,0x3800,0x3810,0x37f0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,
-0x37f0,0x37f0,0x3810,0x3810,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x37f0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x3800,0x3810,0x3810,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3800,0x3810,0x3810,0x37e0,0x37e0,0x37f0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37f0,0x37e0,0x37f0,0x3810,0x3800,0x3800,0x3800,0x3810,0x3800,0x3800,0x3810,0x3800,0x3800,0x3810,0x3810,0x3810,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3810,0x3810,0x3800,0x3810,0x3800,0x3800,0x3810,0x3810,0x3810,0x3810,0x3810,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,
-0x37f0,0x37f0,0x37f0,0x3800,0x3810,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37e0,0x37f0,0x37e0,0x37e0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3810,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,
-0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,
-0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,
-0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,
-0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x3800,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0,0x37f0
-};
@@ -0,0 +1,25 @@
+/**
+ * 17.15 fixed point
+ *
+ * Game positions and speeds are kept in pixels with 15 fraction bits, so
+ * motion of less than a pixel per simulation tick still adds up, and
+ * the M0+ never needs floating point for them.
+ */
+
+#ifndef FIX15_H
+#define FIX15_H
+
+#include <stdlib.h>
+#include "pico/divider.h"
+
+typedef signed int fix15 ;
+#define multfix15(a,b) ((fix15)((((signed long long)(a))*((signed long long)(b)))>>15))
+#define float2fix15(a) ((fix15)((a)*32768.0)) // 2^15
+#define fix2float15(a) ((float)(a)/32768.0)
+#define absfix15(a) abs(a) 
+#define int2fix15(a) ((fix15)((a) << 15))
+#define fix2int15(a) ((int)((a) >> 15))
+#define char2fix15(a) (fix15)(((fix15)(a)) << 15)
+#define divfix(a,b) (fix15)(div_s64s64( (((signed long long)(a)) << 15), ((signed long long)(b))))
+
+#endif
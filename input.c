@@ -0,0 +1,168 @@
+/**
+ * Buttons and joysticks, see input.h
+ */
+
+#include "pico/stdlib.h"
+#include "input.h"
+
+// Joystick nibble to direction. Where switches disagree, this follows
+// the order the game always tested them in: up-left, left, down-left,
+// down-right, right, up-right, and the straight directions only when
+// neither side is held.
+static const input_dir_t directions[16] = {
+  { 0,  0,  0,  0},  // ----
+  { 0, -1,  0, -3},  // U---
+  { 0,  1,  0,  3},  // -D--
+  { 0, -1,  0, -3},  // UD--
+  {-1,  0, -3,  0},  // --L-
+  {-1, -1, -3, -3},  // U-L-
+  {-1,  1, -3,  3},  // -DL-
+  {-1, -1, -3, -3},  // UDL-
+  { 1,  0,  3,  0},  // ---R
+  { 1, -1,  3, -3},  // U--R
+  { 1,  1,  3,  3},  // -D-R
+  { 1,  1,  3,  3},  // UD-R
+  {-1,  0, -3,  0},  // --LR
+  {-1, -1, -3, -3},  // U-LR
+  {-1,  1, -3,  3},  // -DLR
+  {-1, -1, -3, -3},  // UDLR
+} ;
+
+static input_pins_t pins[INPUT_MAX_PLAYERS] ;
+static unsigned int players ;
+static uint32_t input_mask ;
+
+// Joystick bits of players driven from software, -1 for the pins
+static volatile int driven[INPUT_MAX_PLAYERS] = {-1, -1, -1, -1} ;
+
+_Static_assert(INPUT_DEBOUNCE >= 1 && INPUT_DEBOUNCE <= 15, "INPUT_DEBOUNCE must be 1 to 15") ;
+
+// Bits in each pin's count, enough to hold INPUT_DEBOUNCE
+#define COUNT_BITS ((INPUT_DEBOUNCE < 2) ? 1 : (INPUT_DEBOUNCE < 4) ? 2 : (INPUT_DEBOUNCE < 8) ? 3 : 4)
+
+// Debounced state (1 = held), the vertical counter of updates each pin
+// is ignored for (bit b of every pin's count in count[b]), and the last
+// changes
+static uint32_t held ;
+static uint32_t count[COUNT_BITS] ;
+static uint32_t pressed, released ;
+
+void input_init(const input_pins_t * map, unsigned int count, uint32_t button_mask) {
+  if (count > INPUT_MAX_PLAYERS) {
+    count = INPUT_MAX_PLAYERS ;
+  }
+  players = count ;
+  input_mask = button_mask ;
+  for (unsigned int i = 0; i < count; i++) {
+    pins[i] = map[i] ;
+    input_mask |= (1u << map[i].up) | (1u << map[i].down) | (1u << map[i].left) | (1u << map[i].right) ;
+  }
+
+  gpio_init_mask(input_mask) ;
+  gpio_set_dir_in_masked(input_mask) ;
+  for (unsigned int pin = 0; pin < 32; pin++) {
+    if (input_mask & (1u << pin)) {
+      gpio_pull_up(pin) ;
+    }
+  }
+
+  input_reset() ;
+}
+
+void input_reset(void) {
+  held = 0 ;
+  for (int b = 0; b < COUNT_BITS; b++) {
+    count[b] = 0 ;
+  }
+  pressed = released = 0 ;
+}
+
+void input_update(void) {
+  uint32_t sample = ~gpio_get_all() & input_mask ;
+
+  // Pins still counting down from their last change are ignored; the
+  // rest follow the sample at once, all pins at a time
+  uint32_t locked = 0 ;
+  for (int b = 0; b < COUNT_BITS; b++) {
+    locked |= count[b] ;
+  }
+  uint32_t toggle = (sample ^ held) & ~locked ;
+  held ^= toggle ;
+
+  // Count the locked pins down, and start the ones that just changed
+  // from INPUT_DEBOUNCE
+  uint32_t borrow = locked ;
+  for (int b = 0; b < COUNT_BITS; b++) {
+    uint32_t next = count[b] ^ borrow ;
+    borrow &= ~count[b] ;
+    count[b] = ((INPUT_DEBOUNCE >> b) & 1) ? (next | toggle) : (next & ~toggle) ;
+  }
+
+  pressed = toggle & held ;
+  released = toggle & ~held ;
+}
+
+uint32_t input_held(void) {
+  return held ;
+}
+
+uint32_t input_pressed(void) {
+  return pressed ;
+}
+
+uint32_t input_released(void) {
+  return released ;
+}
+
+// Gather a player's four switches from a pin mask into a nibble
+static unsigned int nibble(uint32_t bits, const input_pins_t * p) {
+  return ((bits >> p->up) & 1) | (((bits >> p->down) & 1) << 1) |
+         (((bits >> p->left) & 1) << 2) | (((bits >> p->right) & 1) << 3) ;
+}
+
+unsigned int input_stick(unsigned int player) {
+  if (player >= players) {
+    return 0 ;
+  }
+  int bits = driven[player] ;
+  return (bits >= 0) ? (unsigned int) bits : nibble(held, &pins[player]) ;
+}
+
+unsigned int input_stick_pressed(unsigned int player) {
+  return (player < players) ? nibble(pressed, &pins[player]) : 0 ;
+}
+
+input_dir_t input_direction(unsigned int player) {
+  return directions[input_stick(player)] ;
+}
+
+void input_drive_stick(unsigned int player, unsigned int bits) {
+  if (player < INPUT_MAX_PLAYERS) {
+    driven[player] = bits & 0xf ;
+  }
+}
+
+void input_release_stick(unsigned int player) {
+  if (player < INPUT_MAX_PLAYERS) {
+    driven[player] = -1 ;
+  }
+}
+
+unsigned int input_players(void) {
+  return players ;
+}
+
+uint32_t input_pin_mask(void) {
+  return input_mask ;
+}
+
+uint32_t input_stick_mask(unsigned int bits) {
+  uint32_t mask = 0 ;
+  for (unsigned int i = 0; i < players; i++) {
+    if (bits & INPUT_UP)    mask |= 1u << pins[i].up ;
+    if (bits & INPUT_DOWN)  mask |= 1u << pins[i].down ;
+    if (bits & INPUT_LEFT)  mask |= 1u << pins[i].left ;
+    if (bits & INPUT_RIGHT) mask |= 1u << pins[i].right ;
+  }
+  return mask ;
+}
@@ -0,0 +1,89 @@
+/**
+ * Buttons and joysticks, read once per tick
+ *
+ * input_update takes one gpio_get_all() snapshot, debounces every input
+ * pin at once, and works out which ones were pressed or released since
+ * the previous update. All inputs are switches to ground with pull-ups,
+ * so a low pin reads as held.
+ *
+ * Each player's joystick is a set of four pins given in an input_pins_t,
+ * so another player is one more entry in the table passed to input_init.
+ * Its four switches form a nibble that a lookup table turns into a
+ * direction.
+ *
+ * A pin changes state on the first update that reads it changed, so a
+ * press costs no latency, and then ignores the pin for the next
+ * INPUT_DEBOUNCE updates while its contacts bounce. The count of
+ * updates left is a vertical counter: bit b of every pin's count is in
+ * one word, so all pins count at once, with as many words as
+ * INPUT_DEBOUNCE needs.
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Most joysticks in the pin map
+#define INPUT_MAX_PLAYERS 4
+// Updates a pin is ignored for after it changes state, 1 to 15
+#ifndef INPUT_DEBOUNCE
+#define INPUT_DEBOUNCE 3
+#endif
+
+// Bits of a joystick nibble
+#define INPUT_UP    0x1
+#define INPUT_DOWN  0x2
+#define INPUT_LEFT  0x4
+#define INPUT_RIGHT 0x8
+
+// GPIO numbers of one player's joystick switches
+typedef struct {
+  uint8_t up, down, left, right ;
+} input_pins_t ;
+
+// Direction of a joystick: each of dx, dy is -1, 0 or 1, and the eye
+// offset is where the player's eyes look, in pixels
+typedef struct {
+  int8_t dx, dy ;
+  int8_t eye_x, eye_y ;
+} input_dir_t ;
+
+// Set up the joystick pins of count players, and the other buttons in
+// button_mask (a bit per GPIO), as pulled-up inputs
+void input_init(const input_pins_t * players, unsigned int count, uint32_t button_mask) ;
+
+// Take a snapshot and update the held, pressed and released states
+void input_update(void) ;
+// Forget every pin's state, as if nothing were held, so a stick left
+// held from before starts over through the debounce
+void input_reset(void) ;
+
+// Pins held now, and pins that became held or released at the last
+// update, a bit per GPIO
+uint32_t input_held(void) ;
+uint32_t input_pressed(void) ;
+uint32_t input_released(void) ;
+
+// A player's joystick as an INPUT_UP.. nibble, held or newly pressed
+unsigned int input_stick(unsigned int player) ;
+unsigned int input_stick_pressed(unsigned int player) ;
+// A player's joystick direction
+input_dir_t input_direction(unsigned int player) ;
+
+// Drive a player's joystick from software (an autopilot) instead of its
+// pins: input_stick and input_direction return bits for that player
+// until input_release_stick
+void input_drive_stick(unsigned int player, unsigned int bits) ;
+void input_release_stick(unsigned int player) ;
+
+// Number of players in the pin map
+unsigned int input_players(void) ;
+
+// Every input pin, and the pins of the given INPUT_UP.. switches on all
+// joysticks, a bit per GPIO
+uint32_t input_pin_mask(void) ;
+uint32_t input_stick_mask(unsigned int bits) ;
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Obstacle pool, see obstacles.h
+ */
+
+#include "pico/stdlib.h"
+#include "obstacles.h"
+
+void obstacles_init(obstacles_t * o) {
+  o->count = 0 ;
+}
+
+int obstacles_spawn(obstacles_t * o, fix15 x, fix15 length, fix15 top, fix15 bottom, fix15 gap) {
+  if (o->count == OBSTACLES_MAX) {
+    return -1 ;
+  }
+  unsigned int i = o->count++ ;
+  o->x[i] = o->prev_x[i] = x ;
+  o->length[i] = o->prev_length[i] = length ;
+  o->top[i] = top ;
+  o->bottom[i] = bottom ;
+  o->gap[i] = gap ;
+  o->flags[i] = 0 ;
+  return i ;
+}
+
+void obstacles_retire(obstacles_t * o, unsigned int i) {
+  unsigned int last = --o->count ;
+  if (i == last) {
+    return ;
+  }
+  o->x[i] = o->x[last] ;
+  o->length[i] = o->length[last] ;
+  o->top[i] = o->top[last] ;
+  o->bottom[i] = o->bottom[last] ;
+  o->gap[i] = o->gap[last] ;
+  o->prev_x[i] = o->prev_x[last] ;
+  o->prev_length[i] = o->prev_length[last] ;
+  o->flags[i] = o->flags[last] ;
+}
+
+unsigned int obstacles_step(obstacles_t * o, fix15 speed) {
+  unsigned int retired = 0 ;
+  unsigned int i = 0 ;
+  while (i < o->count) {
+    o->prev_x[i] = o->x[i] ;
+    o->prev_length[i] = o->length[i] ;
+    if (o->x[i] > 0) {
+      o->x[i] -= speed ;
+    }
+    else if (o->length[i] > 0) {
+      o->length[i] -= speed ;
+    }
+    else {
+      obstacles_retire(o, i) ;
+      retired++ ;
+      continue ;
+    }
+    i++ ;
+  }
+  return retired ;
+}
+
+int obstacles_collide(const obstacles_t * o, const aabb_t * box, fix15 dx, fix15 dy, collision_t * hit) {
+  // Bounds of the box's whole path this tick
+  fix15 sx0 = box->x + (dx < 0 ? dx : 0) ;
+  fix15 sx1 = box->x + box->w + (dx > 0 ? dx : 0) ;
+  fix15 sy0 = box->y + (dy < 0 ? dy : 0) ;
+  fix15 sy1 = box->y + box->h + (dy > 0 ? dy : 0) ;
+  int first = -1 ;
+
+  for (unsigned int i = 0; i < o->count; i++) {
+    // An obstacle either slides left, or shrinks at the left edge of the
+    // screen (its right end retreating, which can't run into anything),
+    // so its box is the narrower of the two at its start position
+    fix15 width = (o->length[i] < o->prev_length[i]) ? o->length[i] : o->prev_length[i] ;
+    fix15 ox = o->prev_x[i] ;
+    // Wholly inside the tunnel, or clear of the obstacle's path
+    if ((sy0 > o->top[i]) & (sy1 < o->bottom[i])) continue ;
+    if ((sx1 < o->x[i]) | (sx0 > ox + width) | (width <= 0)) continue ;
+
+    fix15 odx = o->x[i] - ox ;
+    aabb_t top = {ox, 0, width, o->top[i]} ;
+    aabb_t bottom = {ox, o->bottom[i], width, int2fix15(OBSTACLES_FLOOR) - o->bottom[i]} ;
+    collision_t h ;
+    if (collide_swept(box, dx, dy, &top, odx, 0, &h) && (first < 0 || h.toi < hit->toi)) {
+      first = i ;
+      *hit = h ;
+    }
+    if (collide_swept(box, dx, dy, &bottom, odx, 0, &h) && (first < 0 || h.toi < hit->toi)) {
+      first = i ;
+      *hit = h ;
+    }
+  }
+  return first ;
+}
@@ -0,0 +1,67 @@
+/**
+ * Pool of obstacles, in structure-of-arrays form
+ *
+ * Live obstacles are packed at the front of every array: spawning
+ * appends, and retiring moves the last one into the hole, so spawn and
+ * retire are O(1) and every loop runs over the live entries only. Each
+ * field is its own array, so a loop reads just the fields it needs.
+ *
+ * An obstacle is a wall with a gap (the tunnel) in it: a top half from
+ * the top of the screen down to top, and a bottom half from bottom down
+ * to the bottom of the screen. The two edges are stored as the collision
+ * test uses them, and obstacles_collide rejects most obstacles with a
+ * couple of compares before doing a swept test.
+ */
+
+#ifndef OBSTACLES_H
+#define OBSTACLES_H
+
+#include <stdint.h>
+#include "fix15.h"
+#include "collision.h"
+
+// Capacity of a pool
+#ifndef OBSTACLES_MAX
+#define OBSTACLES_MAX 16
+#endif
+
+// Screen height, the bottom edge of the bottom half
+#define OBSTACLES_FLOOR 480
+
+// Per-obstacle flags
+#define OBSTACLE_PASSED  0x01  // counted as passed
+#define OBSTACLE_CHAINED 0x02  // the obstacle behind it has been spawned
+
+typedef struct {
+  unsigned int count ;                // live obstacles, at 0..count-1
+  fix15 x[OBSTACLES_MAX] ;            // left edge
+  fix15 length[OBSTACLES_MAX] ;       // width
+  fix15 top[OBSTACLES_MAX] ;          // bottom edge of the top half
+  fix15 bottom[OBSTACLES_MAX] ;       // top edge of the bottom half
+  fix15 gap[OBSTACLES_MAX] ;          // space behind it before the next one
+  fix15 prev_x[OBSTACLES_MAX] ;       // x and length at the start of the tick
+  fix15 prev_length[OBSTACLES_MAX] ;
+  uint8_t flags[OBSTACLES_MAX] ;
+} obstacles_t ;
+
+// Empty the pool
+void obstacles_init(obstacles_t * o) ;
+
+// Add an obstacle, returns its index or -1 if the pool is full
+int obstacles_spawn(obstacles_t * o, fix15 x, fix15 length, fix15 top, fix15 bottom, fix15 gap) ;
+
+// Remove obstacle i. The last obstacle takes its index, so a loop that
+// retires must look at index i again.
+void obstacles_retire(obstacles_t * o, unsigned int i) ;
+
+// One tick: every obstacle slides left by speed, or once its left edge
+// reaches 0, shrinks from the right until it is gone. Gone obstacles are
+// retired. Returns how many were.
+unsigned int obstacles_step(obstacles_t * o, fix15 speed) ;
+
+// First obstacle that a box moving (dx, dy) this tick runs into, against
+// each obstacle's own motion this tick. Returns its index, and the time
+// and side of impact in hit, or -1 if none.
+int obstacles_collide(const obstacles_t * o, const aabb_t * box, fix15 dx, fix15 dy, collision_t * hit) ;
+
+#endif
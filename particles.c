@@ -0,0 +1,111 @@
+/**
+ * Particle pool, see particles.h
+ */
+
+#include "pico/stdlib.h"
+#include "vga_graphics.h"
+#include "particles.h"
+
+// cos of 16 directions around the circle; sin is 4 entries back
+static const fix15 direction[16] = {
+  float2fix15(1.0), float2fix15(0.9239), float2fix15(0.7071), float2fix15(0.3827),
+  float2fix15(0.0), float2fix15(-0.3827), float2fix15(-0.7071), float2fix15(-0.9239),
+  float2fix15(-1.0), float2fix15(-0.9239), float2fix15(-0.7071), float2fix15(-0.3827),
+  float2fix15(0.0), float2fix15(0.3827), float2fix15(0.7071), float2fix15(0.9239),
+} ;
+
+void particles_init(particles_t * p, uint32_t seed) {
+  p->count = 0 ;
+  p->dirty = 0 ;
+  p->dropped = 0 ;
+  rng_seed(&p->rng, seed) ;
+}
+
+static void particles_retire(particles_t * p, unsigned int i) {
+  unsigned int last = --p->count ;
+  if (i == last) {
+    return ;
+  }
+  p->x[i] = p->x[last] ;
+  p->y[i] = p->y[last] ;
+  p->vx[i] = p->vx[last] ;
+  p->vy[i] = p->vy[last] ;
+  p->life[i] = p->life[last] ;
+  p->color[i] = p->color[last] ;
+}
+
+unsigned int particles_burst(particles_t * p, int x, int y, unsigned int n, fix15 speed, unsigned int life, char color) {
+  unsigned int room = PARTICLES_MAX - p->count ;
+  if (n > room) {
+    p->dropped += n - room ;
+    n = room ;
+  }
+  if (life > 255) life = 255 ;
+  if (life < 2) life = 2 ;
+  for (unsigned int k = 0; k < n; k++) {
+    unsigned int i = p->count++ ;
+    uint32_t r = rng_next(&p->rng) ;
+    // Direction in the low 4 bits, speed from half to full in the next 8
+    unsigned int d = r & 15 ;
+    fix15 v = (speed >> 1) + (fix15)(((int64_t)(speed >> 1) * ((r >> 4) & 255)) >> 8) ;
+    p->x[i] = int2fix15(x) ;
+    p->y[i] = int2fix15(y) ;
+    p->vx[i] = multfix15(v, direction[d]) ;
+    p->vy[i] = multfix15(v, direction[(d + 12) & 15]) ;
+    p->life[i] = (uint8_t)(life / 2 + rng_below(&p->rng, life - life / 2)) + 1 ;
+    p->color[i] = color ;
+  }
+  return n ;
+}
+
+void particles_step(particles_t * p, fix15 gravity) {
+  unsigned int i = 0 ;
+  while (i < p->count) {
+    if (--p->life[i] == 0) {
+      particles_retire(p, i) ;
+      continue ;
+    }
+    p->x[i] += p->vx[i] ;
+    p->vy[i] += gravity ;
+    p->y[i] += p->vy[i] ;
+    i++ ;
+  }
+}
+
+void particles_erase(particles_t * p) {
+  for (unsigned int i = 0; i < p->dirty; i++) {
+    for (int row = 0; row < PARTICLE_SIZE; row++) {
+      drawSpan(p->dirty_x[i], p->dirty_y[i] + row, PARTICLE_SIZE, BLACK) ;
+    }
+  }
+  p->dirty = 0 ;
+}
+
+unsigned int particles_draw(particles_t * p, unsigned int budget) {
+  unsigned int used = 0 ;
+  unsigned int i = 0 ;
+  p->dirty = 0 ;
+  while (i < p->count) {
+    int x = fix2int15(p->x[i]) ;
+    int y = fix2int15(p->y[i]) ;
+    if (x < 0 || x > 640 - PARTICLE_SIZE || y < 0 || y > 480 - PARTICLE_SIZE) {
+      particles_retire(p, i) ;
+      continue ;
+    }
+    if (used + PARTICLE_PIXELS > budget) {
+      // Out of budget: the rest go now rather than the frame running late
+      p->dropped += p->count - i ;
+      p->count = i ;
+      break ;
+    }
+    for (int row = 0; row < PARTICLE_SIZE; row++) {
+      drawSpan(x, y + row, PARTICLE_SIZE, p->color[i]) ;
+    }
+    p->dirty_x[p->dirty] = x ;
+    p->dirty_y[p->dirty] = y ;
+    p->dirty++ ;
+    used += PARTICLE_PIXELS ;
+    i++ ;
+  }
+  return used ;
+}
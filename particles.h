@@ -0,0 +1,68 @@
+/**
+ * Pool of particles, in structure-of-arrays form
+ *
+ * Live particles are packed at the front of every array, as in
+ * obstacles_t: spawning appends and retiring moves the last one into the
+ * hole. Each particle is a PARTICLE_SIZE square drawn with drawSpan, and
+ * the positions drawn are kept so the next frame erases exactly those
+ * pixels instead of clearing the screen.
+ *
+ * particles_draw takes a budget of pixels for the frame. Particles past
+ * the budget are dropped (retired and counted), so a slow frame sheds
+ * particles instead of running over.
+ */
+
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <stdint.h>
+#include "fix15.h"
+#include "rng.h"
+
+// Capacity of a pool
+#ifndef PARTICLES_MAX
+#define PARTICLES_MAX 256
+#endif
+
+// Side of a particle, and the pixels it costs to draw
+#define PARTICLE_SIZE 2
+#define PARTICLE_PIXELS (PARTICLE_SIZE * PARTICLE_SIZE)
+
+typedef struct {
+  unsigned int count ;                // live particles, at 0..count-1
+  fix15 x[PARTICLES_MAX] ;            // top left, pixels
+  fix15 y[PARTICLES_MAX] ;
+  fix15 vx[PARTICLES_MAX] ;           // pixels per frame
+  fix15 vy[PARTICLES_MAX] ;
+  uint8_t life[PARTICLES_MAX] ;       // frames left
+  uint8_t color[PARTICLES_MAX] ;
+  // Where particles were drawn last frame, to erase
+  unsigned int dirty ;
+  int16_t dirty_x[PARTICLES_MAX] ;
+  int16_t dirty_y[PARTICLES_MAX] ;
+  // Particles dropped, for a full pool or over budget
+  unsigned int dropped ;
+  rng_t rng ;
+} particles_t ;
+
+// Empty the pool, with a seed for burst directions and lives
+void particles_init(particles_t * p, uint32_t seed) ;
+
+// n particles flying out from pixel x, y in every direction, at up to
+// speed pixels per frame, each living life/2..life frames. Returns how
+// many fit in the pool.
+unsigned int particles_burst(particles_t * p, int x, int y, unsigned int n, fix15 speed, unsigned int life, char color) ;
+
+// One frame: age and move every particle, gravity pulling it down.
+// Particles at the end of their life are retired.
+void particles_step(particles_t * p, fix15 gravity) ;
+
+// Black out what was last drawn
+void particles_erase(particles_t * p) ;
+
+// Draw every particle, within budget pixels. Particles off the screen
+// are retired, and those past the budget dropped. Returns the pixels
+// drawn.
+unsigned int particles_draw(particles_t * p, unsigned int budget) ;
+
+#endif
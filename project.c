@@ -36,30 +36,50 @@
 #include "hardware/pll.h"
 // Include protothreads
 #include "pt_cornell_rp2040_v1.h"
-// Include 8-bit audio file and death crash sound
-#include "audio_cropped_8bit.c"
-#include "death_crash_cropped.c" 
-
-// === the fixed point macros ========================================
-typedef signed int fix15 ;
-#define multfix15(a,b) ((fix15)((((signed long long)(a))*((signed long long)(b)))>>15))
-#define float2fix15(a) ((fix15)((a)*32768.0)) // 2^15
-#define fix2float15(a) ((float)(a)/32768.0)
-#define absfix15(a) abs(a) 
-#define int2fix15(a) ((fix15)(a << 15))
-#define fix2int15(a) ((int)(a >> 15))
-#define char2fix15(a) (fix15)(((fix15)(a)) << 15)
-#define divfix(a,b) (fix15)(div_s64s64( (((signed long long)(a)) << 15), ((signed long long)(b))))
-
-
-
-// Number of samples per period in sine table
-#define array_size 414544
-#define death_array_size 5957
-
-// Pointer to the address of the DAC data table
-unsigned const short * DAC_pointer = &audio_cropped_8bit[0] ;
-unsigned const short * Death_Pointer = &death_crash_cropped[0] ;
+#ifdef RUN_BENCHMARKS
+#include "bench_pt.h"
+#endif
+// Include fixed point and swept collisions
+#include "fix15.h"
+#include "collision.h"
+// Include the input layer
+#include "input.h"
+// Include the obstacle pool and random numbers
+#include "obstacles.h"
+#include "rng.h"
+// Include the particle pool and the starfield
+#include "particles.h"
+#include "starfield.h"
+// Include DMA audio output
+#include "audio.h"
+#include "sfx.h"
+// Include 8-bit audio file and death crash sound (generated from assets/ at build time)
+#include "audio_cropped_8bit.h"
+#include "death_crash_cropped.h"
+#ifdef RUN_BENCHMARKS
+#include "bench.h"
+#endif
+#ifdef AUTOPILOT
+#include "bot.h"
+#endif
+
+// === fixed timestep simulation ===================================
+// The game is simulated in SIM_TICK_US steps, however often it is drawn.
+// Speeds were tuned as pixels per 33 ms frame, back when the game moved
+// once per drawn frame; px_per_frame converts them to pixels per tick.
+#define SIM_TICK_US 8333
+#define TUNED_FRAME_US 33000
+#define px_per_frame(a) float2fix15((a) * (double)SIM_TICK_US / TUNED_FRAME_US)
+// Most ticks caught up at once, so a stall doesn't fast-forward
+#define SIM_MAX_TICKS 12
+// Starting barrier speed, and player speed on each axis
+#define BARRIER_SPEED px_per_frame(5)
+#define PLAYER_SPEED px_per_frame(10)
+
+// Number of samples in each audio blob
+#define array_size AUDIO_CROPPED_8BIT_SAMPLES
+#define death_array_size DEATH_CRASH_CROPPED_SAMPLES
+
 // A-channel, 1x, active
 #define DAC_config_chan_A 0b0011000000000000
 
@@ -75,10 +95,31 @@ unsigned const short * Death_Pointer = &death_crash_cropped[0] ;
 const uint32_t transfer_count = array_size ;
 const uint32_t death_transfer_count = death_array_size ;
 
-
-// Select DMA channels
-int data_chan = 2;
-int ctrl_chan = 3;
+// Joystick pins, one entry per player (joystick 2 is plugged in backwards)
+static const input_pins_t player_pins[] = {
+  {.up = 11, .down = 10, .left = 12, .right = 13},
+  {.up = 8, .down = 9, .left = 7, .right = 6},
+};
+// Start button
+#define BUTTON_PIN 15
+// Pins whose presses the start menu waits for
+#define MENU_PINS (input_stick_mask(INPUT_UP | INPUT_DOWN) | (1u << BUTTON_PIN))
+// How long the end screen waits for the button before going back to
+// the menu
+#ifdef AUTOPILOT
+#define END_SCREEN_US 3000000
+#else
+#define END_SCREEN_US 30000000
+#endif
+
+#ifdef AUTOPILOT
+// Unattended runs: the menu starts a game by itself after this long, and
+// games start at barrier AUTOPILOT_START (its speed and tunnel height)
+#define AUTOPILOT_MENU_US 2000000
+#ifndef AUTOPILOT_START
+#define AUTOPILOT_START 0
+#endif
+#endif
 
 // Create arrays for printing to VGA
 char score_array [30];
@@ -97,47 +138,56 @@ unsigned int start = 1;
 unsigned int high_score = 0;
 unsigned int player1win = 0;
 unsigned int player2win = 0;
-unsigned int reset = 0;
-unsigned int audio_speed = 0xffff;
-unsigned int p1_x_offset = 0;
-unsigned int p1_y_offset = 0;
-unsigned int p2_x_offset = 0;
-unsigned int p2_y_offset = 0;
-
-// Struct that controls player position
+// Music tempo step, raised as the game speeds up (see protothread_music)
+volatile unsigned int music_level = 0;
+// Screen being shown, for the load report
+const char *screen = "menu";
+
+// Where the game is. Threads that only have work in one state park on
+// state_waiters, which SetState and music changes wake. CRASH is the
+// death animation, between the last frame of a game and the end screen.
+enum game_state {STATE_MENU, STATE_PLAY, STATE_CRASH, STATE_DEAD};
+volatile enum game_state state = STATE_MENU;
+volatile unsigned int state_waiters;
+
+void SetState(enum game_state s) {
+  state = s;
+  pt_wake(&state_waiters);
+}
+
+// Struct that controls player position, in fix15 pixels
 typedef struct
 {
-  int xpos;
-  int ypos;
+  fix15 xpos;
+  fix15 ypos;
+  // Velocity from the joystick, pixels per tick
+  fix15 xvel;
+  fix15 yvel;
+  // Position at the start of the tick
+  fix15 prev_x;
+  fix15 prev_y;
+  // Direction the eyes look
+  int x_offset;
+  int y_offset;
 } Player;
-Player player1 = {
-  .xpos = 100,
-  .ypos = 210
-};
-Player player2 = {
-  .xpos = 100,
-  .ypos = 240
-};
 
-
-void drawPlayer1() {
-  fillRect(player1.xpos, player1.ypos, 30, 30, RED);
-  
-  fillCircle(player1.xpos + 11, player1.ypos + 11, 5, WHITE);
-  fillCircle(player1.xpos + 23, player1.ypos + 11, 5, WHITE);
-  
-  fillCircle(player1.xpos + 11 + p1_x_offset, player1.ypos + 11 + p1_y_offset, 2, BLACK);
-  fillCircle(player1.xpos + 23 + p1_x_offset, player1.ypos + 11 + p1_y_offset, 2, BLACK);
+// Put a player back at its starting position
+void ResetPlayer(Player *p, int x, int y) {
+  p->xpos = p->prev_x = int2fix15(x);
+  p->ypos = p->prev_y = int2fix15(y);
+  p->xvel = p->yvel = 0;
+  p->x_offset = p->y_offset = 0;
 }
 
-void drawPlayer2() {
-  fillRect(player2.xpos, player2.ypos, 30, 30, CYAN);
+// Draw a player at x, y with its eyes looking eye_x, eye_y pixels over
+void DrawPlayer(int x, int y, int eye_x, int eye_y, char color) {
+  fillRect(x, y, 30, 30, color);
   
-  fillCircle(player2.xpos + 11, player2.ypos + 11, 5, WHITE);
-  fillCircle(player2.xpos + 23, player2.ypos + 11, 5, WHITE);
+  fillCircle(x + 11, y + 11, 5, WHITE);
+  fillCircle(x + 23, y + 11, 5, WHITE);
   
-  fillCircle(player2.xpos + 11 + p2_x_offset, player2.ypos + 11 + p2_y_offset, 2, BLACK);
-  fillCircle(player2.xpos + 23 + p2_x_offset, player2.ypos + 11 + p2_y_offset, 2, BLACK);
+  fillCircle(x + 11 + eye_x, y + 11 + eye_y, 2, BLACK);
+  fillCircle(x + 23 + eye_x, y + 11 + eye_y, 2, BLACK);
 }
 
 
@@ -165,205 +215,320 @@ void StartGame() {
 
   // Draws box around selected mode, default single player
   if (start == 1) {
-    drawRect(215,300,210,50,WHITE);
     start = 0;
     gamemode = 1;
   }
+  drawRect(215,300,210,50,(gamemode == 1) ? WHITE : BLACK);
+  drawRect(215,350,210,50,(gamemode == 2) ? WHITE : BLACK);
+}
 
-  // Switches mode if either joystick goes up or down
-  if (gpio_get(11) == 0 || gpio_get(8) == 0) {
-    drawRect(215,300,210,50,WHITE);
-    drawRect(215,350,210,50,BLACK);
-    gamemode = 1;
+// Moves the box to a player mode when a joystick goes up (1) or down (2)
+void SelectMode(unsigned int mode) {
+  if (gamemode != mode) {
+    sfx_play(SFX_MENU_MOVE);
   }
-  if (gpio_get(10) == 0 || gpio_get(9) == 0) {
-    drawRect(215,350,210,50,WHITE);
-    drawRect(215,300,210,50,BLACK);
-    gamemode = 2;
+  gamemode = mode;
+  drawRect(215,300,210,50,(gamemode == 1) ? WHITE : BLACK);
+  drawRect(215,350,210,50,(gamemode == 2) ? WHITE : BLACK);
+}
+
+// Geometry of one barrier of a course
+typedef struct
+{
+  int barrier_length;
+  int top_height;
+  int tunnel_height;
+  int gap_length;
+} BarrierSpec;
+
+// Barrier number index of the course with this seed. A pure function of
+// the two, so a course can be replayed from its seed, or generated ahead.
+BarrierSpec LevelBarrier(uint32_t seed, unsigned int index) {
+  BarrierSpec spec;
+  rng_t rng;
+  rng_seed(&rng, seed ^ rng_mix(index));
+  // Decrease tunnel height every 3 barriers
+  spec.tunnel_height = 200 - 10 * (int)(index / 3);
+  if (spec.tunnel_height < 50) {
+    spec.tunnel_height = 50;
   }
+  spec.barrier_length = 100 + rng_below(&rng, 400);
+  spec.top_height = rng_below(&rng, 480 - spec.tunnel_height);
+  spec.gap_length = 150 + rng_below(&rng, 350);
+  return spec;
 }
 
-// Creates and moves barriers
-void UpdateBarriers() {
-  // Static parameters and arrays for barriers
-  static int xcoord[3] = {640, 640, 640};
-  static int barrier_length[3];
-  static unsigned int tunnel_height[3] = {200, 200, 200};
-  static unsigned int top_height[3];
-  static unsigned int bottom_height[3];
-  static unsigned int gap_length[3];
-  static unsigned int active_barriers[3] = {1, 0, 0};
-  static unsigned int passed[3] = {0, 0, 0};
-  static unsigned int speed = 5;
-  static unsigned int draw[3] = {1, 1, 1};
-
-
-  // If game ends and restarts, reset all parameters to beginning of game
-  if (reset == 1) {
-    xcoord[0] = xcoord[1] = xcoord[2] = 640;
-    tunnel_height[0] = tunnel_height[1] = tunnel_height[2] = 200;
-    active_barriers[0] = 1;
-    active_barriers[1] = active_barriers[2] = passed[0] = passed[1] = passed[2] = 0;
-    speed = 5;
-    reset = 0;
-    barriers_passed = 0;
-    audio_speed = 0xffff;
-    dma_timer_set_fraction(0, 0x0004, audio_speed) ;
+// One game's barriers: the obstacle pool and how it grows harder
+typedef struct
+{
+  obstacles_t pool;
+  // Course seed, see LevelBarrier
+  uint32_t seed;
+  // Pixels per tick
+  fix15 speed;
+  // Barriers spawned this game
+  unsigned int spawned;
+  // How far the barriers have moved, for the starfield (wraps at
+  // STARFIELD_WRAP)
+  fix15 scrolled;
+} Barriers;
+
+// State of one game session, the context of its simulation thread
+typedef struct
+{
+  Barriers barriers;
+  Player player1;
+  Player player2;
+  // Simulation time not yet stepped, and when it was last updated
+  unsigned int sim_pending_us;
+  unsigned int sim_last_us;
+} Game;
+
+// Create the course's next barrier at the right edge of the screen
+void SpawnBarrier(Barriers *b) {
+  BarrierSpec spec = LevelBarrier(b->seed, b->spawned);
+  if (obstacles_spawn(&b->pool, int2fix15(640), int2fix15(spec.barrier_length), int2fix15(spec.top_height),
+                      int2fix15(spec.top_height + spec.tunnel_height), int2fix15(spec.gap_length)) >= 0) {
+    b->spawned++;
   }
+}
 
-  // Go through all 3 potential barriers
-  for (int i = 0; i < 3; i++) {
-    // Check if a certain barrier is active
-    if (active_barriers[i] == 1) {
-      // Create barrier with random parameters
-      if (xcoord[i] == 640) {
-        barrier_length[i] = 100 + (rand() % 400);
-        top_height[i] = (rand() % (480 - tunnel_height[i]));
-        bottom_height[i] = (480 - tunnel_height[i]) - top_height[i];
-        gap_length[i] = 150 + (rand() % 350);
-      }
+// Put barriers back to barrier first of the course with this seed, at
+// the speed they would have reached by then
+void ResetBarriers(Barriers *b, uint32_t seed, unsigned int first) {
+  obstacles_init(&b->pool);
+  b->seed = seed;
+  b->speed = BARRIER_SPEED + (first / 5) * px_per_frame(1);
+  b->spawned = first;
+  b->scrolled = 0;
+  SpawnBarrier(b);
+}
 
-      // Erase previously drawn barrier
-      drawRect(xcoord[i], 0, barrier_length[i], top_height[i], BLACK);
-      drawRect(xcoord[i], 480-bottom_height[i], barrier_length[i], bottom_height[i], BLACK);
-      
-      // Move barrier right to left
-      if (xcoord[i] > 0) {
-        xcoord[i] -= speed;
-      }
-      // Shrink barrier right to left once at far left
-      else if (barrier_length[i] > 0) {
-        barrier_length[i] -= speed;
-      }
-      // Reset barrier
-      else {
-        xcoord[i] = 640;
-        active_barriers[i] = 0;
-        passed[i] = 0;
-        draw[i] = 0;
-        // Increase game speed every 5 barriers
-        if (barriers_passed % 5 == 0) {
-          speed++;
-        }
-        // Increase audio speed every 15 barriers (no one has gotten to 45)
-        if (barriers_passed == 15) {
-          audio_speed = 0xd903;
-          dma_timer_set_fraction(0, 0x0004, audio_speed) ;
-        }
-        if (barriers_passed == 30) {
-          audio_speed = 0xc350;
-          dma_timer_set_fraction(0, 0x0004, audio_speed) ;
-        }
-        // Decrease tunnel height every 3 barriers
-        if (tunnel_height[i] > 50) {
-          tunnel_height[i] -= 10;
-        }
-      }
+// Reset all parameters to the beginning of a game on a new course (or
+// the same one every time, when built with LEVEL_SEED defined)
+void ResetGame(Game *game) {
+#ifdef LEVEL_SEED
+  uint32_t seed = LEVEL_SEED;
+#else
+  uint32_t seed = rng_rosc_seed();
+#endif
+#ifdef AUTOPILOT
+  unsigned int first = AUTOPILOT_START;
+#else
+  unsigned int first = 0;
+#endif
+  printf("course seed %08x\n", (unsigned int) seed);
+  ResetBarriers(&game->barriers, seed, first);
+  ResetPlayer(&game->player1, 100, 210);
+  ResetPlayer(&game->player2, 100, 240);
+  // The joysticks are only sampled during a game, so what they held at
+  // the end of the last one is stale
+  input_reset();
+  barriers_passed = first;
+  music_level = (first >= 30) ? 2 : first / 15;
+}
 
-      // Activate next barrier once the gap length has passed
-      if ((xcoord[i] + barrier_length[i] + gap_length[i] <= 640) && (xcoord[i] + barrier_length[i] + gap_length[i] >= (641 - speed))) {
-        if (i == 0 || i == 1) {
-          active_barriers[i+1] = 1;
-        }
-        else {
-          active_barriers[0] = 1;
-        }
-      }
+// Moves barriers by one tick, retiring the ones that left the screen and
+// spawning new ones behind them
+void UpdateBarriers(Game *game) {
+  Barriers *b = &game->barriers;
+  obstacles_t *pool = &b->pool;
+
+  // Move barriers right to left, shrinking them once at far left
+  unsigned int retired = obstacles_step(pool, b->speed);
+  b->scrolled += b->speed;
+  if (b->scrolled >= STARFIELD_WRAP) {
+    b->scrolled -= STARFIELD_WRAP;
+  }
+  while (retired--) {
+    // Increase game speed every 5 barriers
+    if (barriers_passed % 5 == 0) {
+      b->speed += px_per_frame(1);
+    }
+    // Increase audio speed every 15 barriers (no one has gotten to 45)
+    if (barriers_passed == 15 || barriers_passed == 30) {
+      music_level = barriers_passed / 15;
+      pt_wake(&state_waiters);
+    }
+  }
 
-      // 1 player control
-      if (gamemode == 1) {
-        // Player has passed barrier
-        if (player1.xpos >= xcoord[i] + barrier_length[i] && passed[i] == 0) {
-          passed[i] = 1;
-          barriers_passed++;
-        }
+  // Spawn the next barrier once the gap behind one has scrolled onto the
+  // screen (new ones go at the end, so this loop doesn't see them)
+  unsigned int count = pool->count;
+  for (unsigned int i = 0; i < count; i++) {
+    if (!(pool->flags[i] & OBSTACLE_CHAINED) && pool->x[i] + pool->length[i] + pool->gap[i] <= int2fix15(640)) {
+      pool->flags[i] |= OBSTACLE_CHAINED;
+      SpawnBarrier(b);
+    }
+  }
 
-        // Check for collision with barrier and end game
-        if (((player1.xpos + 30) >= xcoord[i] && player1.xpos <= (xcoord[i] + barrier_length[i])) && (player1.ypos <= top_height[i] || (player1.ypos+30) >= (480-bottom_height[i]))) {
-          endgame = 1;
-          if (barriers_passed > high_score) {
-            high_score = barriers_passed;
-          }
-        }
-      }
+  // Player (either player in 2 player mode) has passed barrier
+  fix15 front = game->player1.xpos;
+  if (gamemode == 2 && game->player2.xpos > front) {
+    front = game->player2.xpos;
+  }
+  for (unsigned int i = 0; i < pool->count; i++) {
+    if (!(pool->flags[i] & OBSTACLE_PASSED) && front >= pool->x[i] + pool->length[i]) {
+      pool->flags[i] |= OBSTACLE_PASSED;
+      barriers_passed++;
+      sfx_play(SFX_BARRIER_PASS);
+    }
+  }
+}
 
-      // 2 player control
-      else {
-        // Either player has passed barrier
-        if (((player1.xpos >= xcoord[i] + barrier_length[i]) || (player2.xpos >= xcoord[i] + barrier_length[i])) && passed[i] == 0) {
-          passed[i] = 1;
-          barriers_passed++;
-        }
+// Test each player's motion this tick against each barrier's. A player
+// that hits one ends the game (in 2 player mode the other one wins), and
+// is left at the point of contact.
+void CollideBarriers(Game *game) {
+  Player *players[2] = {&game->player1, &game->player2};
+
+  for (int n = 0; n < (int)gamemode; n++) {
+    Player *p = players[n];
+    aabb_t box = {p->prev_x, p->prev_y, int2fix15(30), int2fix15(30)};
+    fix15 pdx = p->xpos - p->prev_x;
+    fix15 pdy = p->ypos - p->prev_y;
+    collision_t hit;
+    if (obstacles_collide(&game->barriers.pool, &box, pdx, pdy, &hit) < 0) {
+      continue;
+    }
 
-        // Check for player 1 collision with barrier, end game and player 2 wins
-        if (((player1.xpos + 30) >= xcoord[i] && player1.xpos <= (xcoord[i] + barrier_length[i])) && (player1.ypos <= top_height[i] || (player1.ypos+30) >= (480-bottom_height[i]))) {
-          endgame = 1;
-          player2win = 1;
-          if (barriers_passed > high_score) {
-            high_score = barriers_passed;
-          }
-        }
-        
-        // Check for player 2 collision with barrier, end game and player 1 wins
-        if (((player2.xpos + 30) >= xcoord[i] && player2.xpos <= (xcoord[i] + barrier_length[i])) && (player2.ypos <= top_height[i] || (player2.ypos+30) >= (480-bottom_height[i]))) {
-          endgame = 1;
-          player1win = 1;
-          if (barriers_passed > high_score) {
-            high_score = barriers_passed;
-          }
-        }
-      }
-      
-      // Draw barriers in updated position unless barrier has just been reset
-      if (draw[i] == 1) {
-        drawRect(xcoord[i], 0, barrier_length[i], top_height[i], WHITE);
-        drawRect(xcoord[i], 480-bottom_height[i], barrier_length[i], bottom_height[i], WHITE);
-      }
-      draw[i] = 1;
-      
+    // End game, in 2 player mode the other player wins
+    endgame = 1;
+    if (gamemode == 2) {
+      if (n == 0) player2win = 1;
+      else player1win = 1;
+    }
+    if (barriers_passed > high_score) {
+      high_score = barriers_passed;
     }
+    p->xpos = p->prev_x + multfix15(pdx, hit.toi);
+    p->ypos = p->prev_y + multfix15(pdy, hit.toi);
   }
 }
 
-void configure_death_audio () {
-  // Setup the control channel
-  dma_channel_config c3 = dma_channel_get_default_config(ctrl_chan);   // default configs
-  channel_config_set_transfer_data_size(&c3, DMA_SIZE_32);             // 32-bit txfers
-  channel_config_set_read_increment(&c3, false);                       // no read incrementing
-  channel_config_set_write_increment(&c3, false);                      // no write incrementing
-  channel_config_set_chain_to(&c3, data_chan);                         // chain to data channel
-
-  dma_channel_configure(
-      ctrl_chan,                          // Channel to be configured
-      &c3,                                 // The configuration we just created
-      &dma_hw->ch[data_chan].read_addr,   // Write address (data channel read address)
-      &Death_Pointer,                       // Read address (POINTER TO AN ADDRESS)
-      1,                                  // Number of transfers
-      false                               // Don't start immediately
-  );
-
-  // Setup the data channel
-  dma_channel_config c4 = dma_channel_get_default_config(data_chan);  // Default configs
-  channel_config_set_transfer_data_size(&c4, DMA_SIZE_16);            // 16-bit txfers
-  channel_config_set_read_increment(&c4, true);                       // yes read incrementing
-  channel_config_set_write_increment(&c4, false);                     // no write incrementing
-  // (X/Y)*sys_clk, where X is the first 16 bytes and Y is the second
-  // sys_clk is 250 MHz. Configured to ~16 kHz
-  dma_timer_set_fraction(0, 0, audio_speed) ;                         // 0xffff for 16 kHz, 0xd903 for 18 kHz, 0xc350 for 20 kHz
-  // 0x3b means timer0 (see SDK manual)
-  channel_config_set_dreq(&c4, 0x3b);                                 // DREQ paced by timer 0
-  // chain to the controller DMA channel
-  channel_config_set_chain_to(&c4, ctrl_chan);                        // Chain to control channel
-
-
-  dma_channel_configure(
-      data_chan,                  // Channel to be configured
-      &c4,                        // The configuration we just created
-      &spi_get_hw(SPI_PORT)->dr,  // write address (SPI data register)
-      death_crash_cropped,         // The initial read address
-      death_array_size,                 // Number of transfers
-      false                       // Don't start immediately.
-  );
+// What the renderer draws: a copy of the simulation, taken by the
+// simulation thread when the renderer hands it an empty frame
+typedef struct
+{
+  unsigned int players;
+  int player_x[2];
+  int player_y[2];
+  int eye_x[2];
+  int eye_y[2];
+  unsigned int barriers;
+  int barrier_x[OBSTACLES_MAX];
+  int barrier_length[OBSTACLES_MAX];
+  int barrier_top[OBSTACLES_MAX];
+  int barrier_bottom[OBSTACLES_MAX];
+  // Barriers passed so far
+  unsigned int passed;
+  // Where the starfield has scrolled to
+  fix15 scroll;
+  // Last frame of the game
+  bool over;
+} Frame;
+
+// Copy what there is to draw of the game into a frame
+void TakeFrame(const Game *game, Frame *f) {
+  const Player *players[2] = {&game->player1, &game->player2};
+  const obstacles_t *pool = &game->barriers.pool;
+
+  f->players = gamemode;
+  for (unsigned int n = 0; n < f->players; n++) {
+    f->player_x[n] = fix2int15(players[n]->xpos);
+    f->player_y[n] = fix2int15(players[n]->ypos);
+    f->eye_x[n] = players[n]->x_offset;
+    f->eye_y[n] = players[n]->y_offset;
+  }
+  f->barriers = 0;
+  for (unsigned int i = 0; i < pool->count; i++) {
+    if (pool->length[i] <= 0) {
+      continue;
+    }
+    unsigned int n = f->barriers++;
+    f->barrier_x[n] = fix2int15(pool->x[i]);
+    f->barrier_length[n] = fix2int15(pool->length[i]);
+    f->barrier_top[n] = fix2int15(pool->top[i]);
+    f->barrier_bottom[n] = fix2int15(pool->bottom[i]);
+  }
+  f->passed = barriers_passed;
+  f->scroll = game->barriers.scrolled;
+  f->over = endgame;
+}
+
+#ifdef AUTOPILOT
+// Copy what the autopilot needs to know of the game into its view
+void TakeBotView(const Game *game, bot_view_t *v) {
+  const Player *players[2] = {&game->player1, &game->player2};
+  const obstacles_t *pool = &game->barriers.pool;
+
+  v->speed = game->barriers.speed;
+  v->step = PLAYER_SPEED;
+  v->players = gamemode;
+  for (unsigned int n = 0; n < v->players; n++) {
+    v->player_x[n] = players[n]->xpos;
+    v->player_y[n] = players[n]->ypos;
+  }
+  v->barriers = 0;
+  for (unsigned int i = 0; i < pool->count; i++) {
+    if (pool->length[i] <= 0) {
+      continue;
+    }
+    unsigned int n = v->barriers++;
+    v->x[n] = pool->x[i];
+    v->length[n] = pool->length[i];
+    v->top[n] = pool->top[i];
+    v->bottom[n] = pool->bottom[i];
+  }
+}
+#endif
+
+// Color of each player
+static const char player_colors[2] = {RED, CYAN};
+
+// Draw a frame's barriers, then its players on top, over whatever is on
+// screen
+void DrawScene(const Frame *f) {
+  for (unsigned int i = 0; i < f->barriers; i++) {
+    drawRect(f->barrier_x[i], 0, f->barrier_length[i], f->barrier_top[i], WHITE);
+    drawRect(f->barrier_x[i], f->barrier_bottom[i], f->barrier_length[i], 480-f->barrier_bottom[i], WHITE);
+  }
+  for (unsigned int n = 0; n < f->players; n++) {
+    DrawPlayer(f->player_x[n], f->player_y[n], f->eye_x[n], f->eye_y[n], player_colors[n]);
+  }
+}
+
+// Erase what was drawn last, draw the new frame, and keep it as drawn
+void DrawFrame(Frame *drawn, const Frame *f) {
+  for (unsigned int i = 0; i < drawn->barriers; i++) {
+    drawRect(drawn->barrier_x[i], 0, drawn->barrier_length[i], drawn->barrier_top[i], BLACK);
+    drawRect(drawn->barrier_x[i], drawn->barrier_bottom[i], drawn->barrier_length[i], 480-drawn->barrier_bottom[i], BLACK);
+  }
+  for (unsigned int n = 0; n < drawn->players; n++) {
+    fillRect(drawn->player_x[n], drawn->player_y[n], 30, 30, BLACK);
+  }
+  DrawScene(f);
+  *drawn = *f;
+}
+
+// The player whose crash ended the game
+static unsigned int DeadPlayer() {
+  return (gamemode == 1 || player2win) ? 0 : 1;
+}
+
+// X out the eyes of the player that died, where a frame has it
+void DrawDeadEyes(const Frame *f) {
+  int n = DeadPlayer();
+  int x = f->player_x[n];
+  int y = f->player_y[n];
+  fillCircle(x + 11, y + 11, 5, WHITE);
+  fillCircle(x + 23, y + 11, 5, WHITE);
+
+  drawLine(x + 7, y + 7, x + 15, y + 15, BLACK);
+  drawLine(x + 15, y + 7, x + 7, y + 15, BLACK);
+
+  drawLine(x + 19, y + 7, x + 27, y + 15, BLACK);
+  drawLine(x + 27, y + 7, x + 19, y + 15, BLACK);
 }
 
 // End game screen
@@ -406,364 +571,605 @@ void EndGame() {
   writeString(press_button_array);
 }
 
-// Move player 1 based on joystick input
-void MovePlayer1() {
-  // Erase previous position
-  fillRect(player1.xpos, player1.ypos, 30, 30, BLACK);
-
-  // Straight Up
-  if (gpio_get(11) == 0 && gpio_get(12) == 1 && gpio_get(13) == 1) {
-    player1.ypos -= 10;
-    p1_x_offset = 0;
-    p1_y_offset = -3;
-  }
-  // Up Left
-  else if (gpio_get(11) == 0 && gpio_get(12) == 0) {
-    player1.ypos -= 10;
-    player1.xpos -= 10;
-    p1_x_offset = -3;
-    p1_y_offset = -3;
-  }
-  // Straight Left
-  else if (gpio_get(10) == 1 && gpio_get(11) == 1 && gpio_get(12) == 0) {
-    player1.xpos -= 10;
-    p1_x_offset = -3;
-    p1_y_offset = 0;
-  }
-  // Down Left
-  else if (gpio_get(10) == 0 && gpio_get(12) == 0) {
-    player1.ypos += 10;
-    player1.xpos -= 10;
-    p1_x_offset = -3;
-    p1_y_offset = 3;
-  }
-  // Straight Down
-  else if (gpio_get(10) == 0 && gpio_get(12) == 1 && gpio_get(13) == 1) {
-    player1.ypos += 10;
-    p1_x_offset = 0;
-    p1_y_offset = 3;
-  }
-  // Down Right
-  else if (gpio_get(10) == 0 && gpio_get(13) == 0) {
-    player1.ypos += 10;
-    player1.xpos += 10;
-    p1_x_offset = 3;
-    p1_y_offset = 3;
-  }
-  // Straight Right
-  else if (gpio_get(10) == 1 && gpio_get(11) == 1 && gpio_get(13) == 0) {
-    player1.xpos += 10;
-    p1_x_offset = 3;
-    p1_y_offset = 0;
-  }
-  // Up Right
-  else if (gpio_get(11) == 0 && gpio_get(13) == 0) {
-    player1.ypos -= 10;
-    player1.xpos += 10;
-    p1_x_offset = 3;
-    p1_y_offset = -3;
-  }
-  // Not Moving
-  else {
-    p1_x_offset=0; 
-    p1_y_offset=0; 
+// Steer a player from its joystick, setting its velocity and the
+// direction its eyes look
+void SteerPlayer(Player *p, unsigned int player) {
+  // Remember direction to tick when it changes
+  int old_x_offset = p->x_offset;
+  int old_y_offset = p->y_offset;
+  input_dir_t dir = input_direction(player);
+
+  p->xvel = dir.dx * PLAYER_SPEED;
+  p->yvel = dir.dy * PLAYER_SPEED;
+  p->x_offset = dir.eye_x;
+  p->y_offset = dir.eye_y;
+
+  // Tick when the player starts moving or changes direction
+  if ((p->x_offset || p->y_offset) && (p->x_offset != old_x_offset || p->y_offset != old_y_offset)) {
+    sfx_play(SFX_PLAYER_MOVE);
   }
-  
+}
+
+// Move a player by one tick
+void MovePlayer(Player *p) {
+  p->prev_x = p->xpos;
+  p->prev_y = p->ypos;
+  p->xpos += p->xvel;
+  p->ypos += p->yvel;
 
   // Keep player within screen
-  if (player1.xpos <= 0) {
-    player1.xpos = 0;
+  if (p->xpos <= 0) {
+    p->xpos = 0;
   }
-  else if (player1.xpos >= 610) {
-    player1.xpos = 610;
+  else if (p->xpos >= int2fix15(610)) {
+    p->xpos = int2fix15(610);
   }
-  if (player1.ypos <= 0) {
-    player1.ypos = 0;
+  if (p->ypos <= 0) {
+    p->ypos = 0;
   }
-  else if (player1.ypos >= 450) {
-    player1.ypos = 450;
+  else if (p->ypos >= int2fix15(450)) {
+    p->ypos = int2fix15(450);
   }
-  
-  // Draw player 1 (red for now)
-  drawPlayer1();
 }
 
-// Move player 2 based on joystick input
-void MovePlayer2() {
-  // Erase previous position
-  fillRect(player2.xpos, player2.ypos, 30, 30, BLACK);
-  
-  // Straight Up
-  if (gpio_get(8) == 0 && gpio_get(7) == 1 && gpio_get(6) == 1) {
-    player2.ypos -= 10;
-    p2_x_offset = 0;
-    p2_y_offset = -3;
-  }
-  // Up Left
-  else if (gpio_get(8) == 0 && gpio_get(7) == 0) {
-    player2.ypos -= 10;
-    player2.xpos -= 10;
-    p2_x_offset = -3;
-    p2_y_offset = -3;
-  }
-  // Straight Left
-  else if (gpio_get(9) == 1 && gpio_get(8) == 1 && gpio_get(7) == 0) {
-    player2.xpos -= 10;
-    p2_x_offset = -3;
-    p2_y_offset = 0;
-  }
-  // Down Left
-  else if (gpio_get(9) == 0 && gpio_get(7) == 0) {
-    player2.ypos += 10;
-    player2.xpos -= 10;
-    p2_x_offset = -3;
-    p2_y_offset = 3;
-  }
-  // Straight Down
-  else if (gpio_get(9) == 0 && gpio_get(7) == 1 && gpio_get(6) == 1) {
-    player2.ypos += 10;
-    p2_x_offset = 0;
-    p2_y_offset = 3;
-  }
-  // Down Right
-  else if (gpio_get(9) == 0 && gpio_get(6) == 0) {
-    player2.ypos += 10;
-    player2.xpos += 10;
-    p2_x_offset = 3;
-    p2_y_offset = 3;
-  }
-  // Straight Right
-  else if (gpio_get(9) == 1 && gpio_get(8) == 1 && gpio_get(6) == 0) {
-    player2.xpos += 10;
-    p2_x_offset = 3;
-    p2_y_offset = 0;
-  }
-  // Up Right
-  else if (gpio_get(8) == 0 && gpio_get(6) == 0) {
-    player2.ypos -= 10;
-    player2.xpos += 10;
-    p2_x_offset = 3;
-    p2_y_offset = -3;
-  }
-  // Not Moving
-  else {
-    p2_x_offset=0; 
-    p2_y_offset=0; 
-  }
-  
-  
-  // Keep player within screen
-  if (player2.xpos <= 0) {
-    player2.xpos = 0;
-  }
-  else if (player2.xpos >= 610) {
-    player2.xpos = 610;
+// One simulation tick: barriers first, then players, as in the original
+// once-per-frame game, then collisions along the way both moved
+void SimStep(Game *game) {
+  UpdateBarriers(game);
+  SteerPlayer(&game->player1, 0);
+  MovePlayer(&game->player1);
+  if (gamemode == 2) {
+    SteerPlayer(&game->player2, 1);
+    MovePlayer(&game->player2);
   }
-  if (player2.ypos <= 0) {
-    player2.ypos = 0;
+  CollideBarriers(game);
+}
+
+// Times the simulation fell more than SIM_MAX_TICKS behind, and dropped
+// the time over
+unsigned int sim_stalls = 0;
+
+// Step the simulation up to now, in whole ticks
+void SimAdvance(Game *game) {
+  unsigned int now = time_us_32();
+  game->sim_pending_us += now - game->sim_last_us;
+  game->sim_last_us = now;
+  if (game->sim_pending_us > SIM_MAX_TICKS * SIM_TICK_US) {
+    game->sim_pending_us = SIM_MAX_TICKS * SIM_TICK_US;
+    sim_stalls++;
   }
-  else if (player2.ypos >= 450) {
-    player2.ypos = 450;
+  while (game->sim_pending_us >= SIM_TICK_US && !endgame) {
+    SimStep(game);
+    game->sim_pending_us -= SIM_TICK_US;
   }
-  
-  // Draw player 2 (blue for now)
-  drawPlayer2();
 }
 
-void configure_audio () {
-  // Setup the control channel
-  dma_channel_config c = dma_channel_get_default_config(ctrl_chan);   // default configs
-  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);             // 32-bit txfers
-  channel_config_set_read_increment(&c, false);                       // no read incrementing
-  channel_config_set_write_increment(&c, false);                      // no write incrementing
-  channel_config_set_chain_to(&c, data_chan);                         // chain to data channel
-
-  dma_channel_configure(
-      ctrl_chan,                          // Channel to be configured
-      &c,                                 // The configuration we just created
-      &dma_hw->ch[data_chan].read_addr,   // Write address (data channel read address)
-      &DAC_pointer,                       // Read address (POINTER TO AN ADDRESS)
-      1,                                  // Number of transfers
-      false                               // Don't start immediately
-  );
+// Score display, on while a game is running
+static bool hud_visible = false ;
 
-  // Setup the data channel
-  dma_channel_config c2 = dma_channel_get_default_config(data_chan);  // Default configs
-  channel_config_set_transfer_data_size(&c2, DMA_SIZE_16);            // 16-bit txfers
-  channel_config_set_read_increment(&c2, true);                       // yes read incrementing
-  channel_config_set_write_increment(&c2, false);                     // no write incrementing
-  // (X/Y)*sys_clk, where X is the first 16 bytes and Y is the second
-  // sys_clk is 250 MHz. Configured to ~16 kHz
-  dma_timer_set_fraction(0, 0, audio_speed) ;                         // 0xffff for 16 kHz, 0xd903 for 18 kHz, 0xc350 for 20 kHz
-  // 0x3b means timer0 (see SDK manual)
-  channel_config_set_dreq(&c2, 0x3b);                                 // DREQ paced by timer 0
-  // chain to the controller DMA channel
-  channel_config_set_chain_to(&c2, ctrl_chan);                        // Chain to control channel
+// Redraws the score at its own rate, released every 100 ms
+static PT_THREAD (protothread_hud(struct pt *pt))
+{
+    PT_BEGIN(pt);
 
+    while(1) {
+      if (hud_visible) {
+        // Print current score, updates after each barrier
+        setCursor(520,5);
+        setTextSize(1);
+        setTextColor(WHITE);
+        sprintf(score_array, "Current score: %d", barriers_passed);
+        fillRect(600, 4, 25, 15, BLACK);
+        writeString(score_array);
+
+        // Print high score, updates after game if beaten
+        setCursor(520,15);
+        setTextSize(1);
+        setTextColor(WHITE);
+        sprintf(high_score_array, "   High score: %d", high_score);
+        fillRect(600, 14, 25, 15, BLACK);
+        writeString(high_score_array);
+      }
+      PT_YIELD(pt);
+    }
 
-  dma_channel_configure(
-      data_chan,                  // Channel to be configured
-      &c2,                        // The configuration we just created
-      &spi_get_hw(SPI_PORT)->dr,  // write address (SPI data register)
-      audio_cropped_8bit,         // The initial read address
-      array_size,                 // Number of transfers
-      false                       // Don't start immediately.
-  );
+    PT_END(pt);
 }
 
+// Counters at the previous load report
+typedef struct
+{
+  unsigned int last_passes[2];
+  unsigned int last_polls[2];
+} LoadReport;
+
+// Reports how idle each core is, and the scheduler passes and polls of
+// a still-false condition per second on each core. Released every 5 s on
+// core 1.
+static PT_THREAD (protothread_load(struct pt *pt, void *ctx))
+{
+    LoadReport *load = ctx;
+    PT_BEGIN(pt);
+
+    while(1) {
+      printf("idle on %s screen: core 0 %d%%, core 1 %d%%\n", screen, pt_core_idle(0), pt_core_idle(1));
+      for (int core = 0; core < 2; core++) {
+        printf("  core %d: %u passes/s, %u wasted polls/s\n", core,
+               (pt_sched_passes[core] - load->last_passes[core]) / 5,
+               (pt_wasted_polls[core] - load->last_polls[core]) / 5);
+        load->last_passes[core] = pt_sched_passes[core] ;
+        load->last_polls[core] = pt_wasted_polls[core] ;
+      }
+      PT_YIELD(pt);
+    }
 
+    PT_END(pt);
+}
 
+#ifdef PT_PROFILE
+// Profiler console on USB stdio, polled every 100 ms on core 1:
+// 'p' prints the per-thread runtime table, 'r' starts a new window
+static PT_THREAD (protothread_profile(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    static int c ;
+    pt_profile_reset() ;
 
+    while(1) {
+      c = getchar_timeout_us(0) ;
+      if (c == 'p') pt_profile_dump() ;
+      else if (c == 'r') pt_profile_reset() ;
+      PT_YIELD(pt);
+    }
 
+    PT_END(pt);
+}
+#endif
+
+// Core 1 owns audio: the refill and mixing IRQ runs there, off the
+// gameplay core
+static void core1_init() {
+  // Start the DMA audio pipeline (plays silence until a sound is queued)
+  audio_init(AUDIO_DEFAULT_BLOCK_SAMPLES) ;
+  // Synthesize the sound effects that get mixed on top
+  sfx_init() ;
+}
 
-// Main thread that runs through game process
-static PT_THREAD (protothread_anim(struct pt *pt))
+// === game threads ===================================
+// The game runs as cooperating threads that each wake for their own
+// reason:
+//  - input samples the joysticks every tick while a game is on
+//  - sim steps the simulation every tick, and copies its state into a
+//    frame when the renderer asks for one
+//  - render asks for a frame once per 33 ms, draws it with its particle
+//    effects, and plays the crash after drawing the last frame of a game
+//  - menu runs the menu and end screen from button events, and starts
+//    games
+//  - music follows the game state and tempo
+// They share the game state (state_waiters) and pass the frame through
+// two queues, so the drawing threads (render, and the HUD with it) can go
+// on the other core from input and sim, and a slow frame never holds up
+// the ticks.
+#define SIM_CORE 0
+#define RENDER_CORE 1
+
+// The one frame, handed to the simulation empty and given back full
+static Frame render_frame;
+static ringq_t frame_free, frame_ready;
+static uint32_t frame_free_buf[2], frame_ready_buf[2];
+// Longest the renderer took to draw a frame, and the simulation thread's
+// entry in its core's thread list, for the soak log
+volatile unsigned int render_max_us;
+static int sim_thread;
+
+#ifdef AUTOPILOT
+// The autopilot's view of the game, passed the same way as the frame
+static bot_view_t bot_view;
+static ringq_t bot_free, bot_ready;
+static uint32_t bot_free_buf[2], bot_ready_buf[2];
+#endif
+
+// Samples the joysticks at the simulation tick rate, so the debounce
+// counts ticks (INPUT_DEBOUNCE of them)
+static PT_THREAD (protothread_input(struct pt *pt))
 {
-    // Mark beginning of thread
     PT_BEGIN(pt);
 
-    static int begin_time ;
-    static int spare_time_0 = 33000 ;
+    while(1) {
+      PT_WAIT_EVENT(pt, state_waiters, state == STATE_PLAY);
+      input_update();
+      PT_YIELD(pt);
+    }
 
-    // Draw Large Player 1 on menu screen
-    fillRect(185, 75, 90, 90, RED);
-  
-    fillCircle(185 + 33, 75 + 33, 15, WHITE);
-    fillCircle(185 + 69, 75 + 33, 15, WHITE);
-    
-    fillCircle(185 + 33, 75 + 33, 6, BLACK);
-    fillCircle(185 + 69, 75 + 33, 6, BLACK);
+    PT_END(pt);
+}
 
-    // Draw Large Player 2 on menu screen
-    fillRect(365, 75, 90, 90, CYAN);
-    
-    fillCircle(365 + 33, 75 + 33, 15, WHITE);
-    fillCircle(365 + 69, 75 + 33, 15, WHITE);
-    
-    fillCircle(365 + 33, 75 + 33, 6, BLACK);
-    fillCircle(365 + 69, 75 + 33, 6, BLACK);
+// Steps the game in fixed ticks, released every tick. The game's state
+// is in its Game context.
+static PT_THREAD (protothread_sim(struct pt *pt, void *ctx))
+{
+    Game *game = ctx;
+    uint32_t frame;
+    PT_BEGIN(pt);
 
-    // Display start menu screen while button not pressed
-    while(gpio_get(15)) {
-      StartGame();
-    }
-    // Check for button press and release
-    while(!gpio_get(15)) {
+    while(1) {
+      // Park until a game starts
+      PT_WAIT_EVENT(pt, state_waiters, state == STATE_PLAY);
+      game->sim_pending_us = 0;
+      game->sim_last_us = time_us_32();
+
+      while (1) {
+        SimAdvance(game);
+        // The last frame is only handed over below, so the renderer gets
+        // it exactly once
+        if (endgame) {
+          break;
+        }
+        // Fill the frame if the renderer is waiting for one
+        if (pt_queue_pop(&frame_free, &frame, 1)) {
+          TakeFrame(game, (Frame *)(uintptr_t) frame);
+          pt_queue_push(&frame_ready, &frame, 1);
+        }
+#ifdef AUTOPILOT
+        // and the autopilot's view, if it is waiting for one
+        if (pt_queue_pop(&bot_free, &frame, 1)) {
+          TakeBotView(game, (bot_view_t *)(uintptr_t) frame);
+          pt_queue_push(&bot_ready, &frame, 1);
+        }
+#endif
+        PT_YIELD(pt);
+      }
 
+      // The renderer always gets the last frame, however long it takes to
+      // ask for it
+      PT_QUEUE_WAIT_DATA(pt, &frame_free, 1);
+      pt_queue_pop(&frame_free, &frame, 1);
+      TakeFrame(game, (Frame *)(uintptr_t) frame);
+      pt_queue_push(&frame_ready, &frame, 1);
+      // Until the menu starts the next game
+      PT_WAIT_EVENT(pt, state_waiters, state != STATE_PLAY);
     }
-    // Black out screen on button release for game start
-    fillRect(0,0,640,480,BLACK);
 
-    // Start audio
-    configure_audio();
-    dma_timer_set_fraction(0, 0x0004, audio_speed) ;
-    
-    // start the control channel
-    dma_start_channel_mask(1u << ctrl_chan) ;
-    
+    PT_END(pt);
+}
 
-    // Draw player 1, add player 2 if 2 player mode
-    drawPlayer1();
-    if (gamemode == 2) {
-      drawPlayer2();
+// Particle effects, in pixels per frame. A frame that takes longer than
+// RENDER_TARGET_US to draw cuts the particle budget by a quarter, and
+// each faster one gives back PARTICLE_BUDGET_STEP pixels, up to
+// PARTICLE_BUDGET_MAX.
+#define RENDER_TARGET_US 10000
+#define PARTICLE_BUDGET_MAX (PARTICLES_MAX * PARTICLE_PIXELS)
+#define PARTICLE_BUDGET_MIN (16 * PARTICLE_PIXELS)
+#define PARTICLE_BUDGET_STEP (8 * PARTICLE_PIXELS)
+#define PARTICLE_GRAVITY float2fix15(0.4)
+// Stars in the background, and the most time a frame spends moving them
+#define STARFIELD_STARS 192
+#define STARFIELD_CAP_US 1500
+
+// What the renderer keeps between frames, the context of its thread
+typedef struct
+{
+  // The frame it last drew, to erase it from
+  Frame drawn;
+  particles_t particles;
+  // Pixels of particles it may draw a frame
+  unsigned int particle_budget;
+  starfield_t stars;
+} Render;
+
+// Draw a frame's particles after the scene, and fit the particle budget
+// to how long the whole frame took
+void DrawParticles(Render *render, unsigned int start) {
+  particles_step(&render->particles, PARTICLE_GRAVITY);
+  particles_draw(&render->particles, render->particle_budget);
+
+  unsigned int elapsed = time_us_32() - start;
+  if (elapsed > render_max_us) {
+    render_max_us = elapsed;
+  }
+  if (elapsed > RENDER_TARGET_US) {
+    render->particle_budget -= render->particle_budget / 4;
+    if (render->particle_budget < PARTICLE_BUDGET_MIN) {
+      render->particle_budget = PARTICLE_BUDGET_MIN;
     }
-    
-    // Gameplay
+  }
+  else if (render->particle_budget < PARTICLE_BUDGET_MAX) {
+    render->particle_budget += PARTICLE_BUDGET_STEP;
+  }
+}
+
+// Draws a frame from the simulation, released once per 33 ms frame, over
+// the starfield and with sparks off the front player as it passes a
+// barrier. After the last
+// frame of a game it plays the crash (STATE_CRASH) until the debris has
+// settled, then hands over to the end screen (STATE_DEAD).
+static PT_THREAD (protothread_render(struct pt *pt, void *ctx))
+{
+    Render *render = ctx;
+    Frame *drawn = &render->drawn;
+    uint32_t frame;
+    PT_BEGIN(pt);
+
     while(1) {
-      begin_time = time_us_32();
-      
-      // Constantly update barriers and move players, depending on game mode
-      UpdateBarriers();
-      MovePlayer1();
-      if (gamemode == 2) {
-        MovePlayer2();
+      // Ask for a frame, and park until it comes (all through the menu)
+      frame = (uint32_t)(uintptr_t) &render_frame;
+      pt_queue_push(&frame_free, &frame, 1);
+      PT_QUEUE_WAIT_DATA(pt, &frame_ready, 1);
+      pt_queue_pop(&frame_ready, &frame, 1);
+      {
+        const Frame *f = (Frame *)(uintptr_t) frame;
+        unsigned int start = time_us_32();
+        particles_erase(&render->particles);
+        // A new game, on a screen the menu has cleared
+        if (!drawn->players) {
+          starfield_clear(&render->stars);
+        }
+        if (drawn->players && f->passed != drawn->passed) {
+          unsigned int n = (f->players == 2 && f->player_x[1] > f->player_x[0]) ? 1 : 0;
+          particles_burst(&render->particles, f->player_x[n] + 30, f->player_y[n] + 15,
+                          12, int2fix15(3), 8, YELLOW);
+        }
+        DrawFrame(drawn, f);
+        starfield_update(&render->stars, f->scroll, STARFIELD_CAP_US);
+        DrawParticles(render, start);
       }
 
-      // If end game flag is 1, jump to end game screen
-      if (endgame == 1) {
-        break;
+      // The game is over once its last frame is on screen: blow up the
+      // player that crashed
+      if (drawn->over) {
+        hud_visible = false;
+        SetState(STATE_CRASH);
+        {
+          unsigned int n = DeadPlayer();
+          int x = drawn->player_x[n] + 15;
+          int y = drawn->player_y[n] + 15;
+          particles_burst(&render->particles, x, y, 96, int2fix15(8), 12, player_colors[n]);
+          particles_burst(&render->particles, x, y, 32, int2fix15(5), 10, WHITE);
+        }
+        while (render->particles.count) {
+          PT_YIELD(pt);
+          {
+            unsigned int start = time_us_32();
+            particles_erase(&render->particles);
+            DrawScene(drawn);
+            DrawDeadEyes(drawn);
+            DrawParticles(render, start);
+          }
+        }
+        SetState(STATE_DEAD);
       }
+      PT_YIELD(pt);
+    }
 
-      // Print current score, updates after each barrier
-      setCursor(520,5);
-      setTextSize(1);
-      setTextColor(WHITE);
-      sprintf(score_array, "Current score: %d", barriers_passed);
-      fillRect(600, 4, 25, 15, BLACK);
-      writeString(score_array);
+    PT_END(pt);
+}
 
-      // Print high score, updates after game if beaten
-      setCursor(520,15);
-      setTextSize(1);
-      setTextColor(WHITE);
-      sprintf(high_score_array, "   High score: %d", high_score);
-      fillRect(600, 14, 25, 15, BLACK);
-      writeString(high_score_array);
+// Button events and deadline of the menu thread's waits
+typedef struct
+{
+  Game *game;
+  Render *render;
+  uint32_t event;
+  unsigned long long deadline;
+} Menu;
+
+// Runs the start menu and the end screen, and starts each game. Parks on
+// button events and the game state, so it does nothing while a game is
+// on.
+static PT_THREAD (protothread_menu(struct pt *pt, void *ctx))
+{
+    Menu *menu = ctx;
+    PT_BEGIN(pt);
+
+    while(1) {
+      // Draw Large Player 1 on menu screen
+      fillRect(185, 75, 90, 90, RED);
+    
+      fillCircle(185 + 33, 75 + 33, 15, WHITE);
+      fillCircle(185 + 69, 75 + 33, 15, WHITE);
       
-      // delay in accordance with frame rate
-      spare_time_0 = 33000 - (time_us_32() - begin_time);
+      fillCircle(185 + 33, 75 + 33, 6, BLACK);
+      fillCircle(185 + 69, 75 + 33, 6, BLACK);
 
-      // yield for necessary amount of time
-      PT_YIELD_usec(spare_time_0) ;
+      // Draw Large Player 2 on menu screen
+      fillRect(365, 75, 90, 90, CYAN);
       
-      // END WHILE(1)
+      fillCircle(365 + 33, 75 + 33, 15, WHITE);
+      fillCircle(365 + 69, 75 + 33, 15, WHITE);
+      
+      fillCircle(365 + 33, 75 + 33, 6, BLACK);
+      fillCircle(365 + 69, 75 + 33, 6, BLACK);
+
+      // Draw the start menu once, then park until a joystick moves the
+      // selection or the button is pressed
+      screen = "menu";
+      StartGame();
+      pt_gpio_flush();
+#ifdef AUTOPILOT
+      menu->deadline = pt_time_us() + AUTOPILOT_MENU_US;
+#else
+      menu->deadline = PT_FOREVER;
+#endif
+      while(1) {
+        PT_WAIT_PRESS(pt, MENU_PINS, menu->deadline, menu->event);
+        if (menu->event == 0 || PT_GPIO_PIN(menu->event) == BUTTON_PIN) {
+          break;
+        }
+        SelectMode((input_stick_mask(INPUT_UP) & (1u << PT_GPIO_PIN(menu->event))) ? 1 : 2);
+      }
+      // Start on button release
+      if (menu->event) {
+        PT_WAIT_RELEASE(pt, 1u << BUTTON_PIN, PT_FOREVER, menu->event);
+      }
+      // Black out screen for game start
+      fillRect(0,0,640,480,BLACK);
+
+      // Put barriers, players and score back to the beginning of a game,
+      // with nothing on screen for the renderer to erase
+      ResetGame(menu->game);
+      menu->render->drawn.players = 0;
+      menu->render->drawn.barriers = 0;
+      hud_visible = true ;
+      screen = "game";
+      SetState(STATE_PLAY);
+
+      // Park until the renderer has drawn the last frame and the crash
+      PT_WAIT_EVENT(pt, state_waiters, state == STATE_DEAD);
+
+      // End game screen
+      EndGame();
+      screen = "end";
+      // Park until the button is pressed, or go back to the menu by
+      // itself after a while
+      pt_gpio_flush();
+      menu->deadline = pt_time_us() + END_SCREEN_US;
+      PT_WAIT_PRESS(pt, 1u << BUTTON_PIN, menu->deadline, menu->event);
+      // Reset necessary flags, the game itself is reset when it starts
+      start = 1;
+      endgame = 0;
+      player1win = 0;
+      player2win = 0;
+      // Back to the menu on button release
+      if (menu->event) {
+        PT_WAIT_RELEASE(pt, 1u << BUTTON_PIN, PT_FOREVER, menu->event);
+      }
+      // Black out screen
+      fillRect(0,0,640,480,BLACK);
+      SetState(STATE_MENU);
     }
-  if (gamemode == 1 || player2win) {
-    fillCircle(player1.xpos + 11, player1.ypos + 11, 5, WHITE);
-    fillCircle(player1.xpos + 23, player1.ypos + 11, 5, WHITE);
-  
-    drawLine(player1.xpos + 7, player1.ypos + 7, player1.xpos + 15, player1.ypos + 15, BLACK);
-    drawLine(player1.xpos + 15, player1.ypos + 7, player1.xpos + 7, player1.ypos + 15, BLACK);
 
-    drawLine(player1.xpos + 19, player1.ypos + 7, player1.xpos + 27, player1.ypos + 15, BLACK);
-    drawLine(player1.xpos + 27, player1.ypos + 7, player1.xpos + 19, player1.ypos + 15, BLACK);
-  }
-  else {
-    fillCircle(player2.xpos + 11, player2.ypos + 11, 5, WHITE);
-    fillCircle(player2.xpos + 23, player2.ypos + 11, 5, WHITE);
-    
-    drawLine(player2.xpos + 7, player2.ypos + 7, player2.xpos + 15, player2.ypos + 15, BLACK);
-    drawLine(player2.xpos + 15, player2.ypos + 7, player2.xpos + 7, player2.ypos + 15, BLACK);
+    PT_END(pt);
+}
 
-    drawLine(player2.xpos + 19, player2.ypos + 7, player2.xpos + 27, player2.ypos + 15, BLACK);
-    drawLine(player2.xpos + 27, player2.ypos + 7, player2.xpos + 19, player2.ypos + 15, BLACK);
-  }
-      // End audio
-    dma_channel_abort(data_chan);
-    configure_death_audio();
-    audio_speed = 0xffff;
-    dma_timer_set_fraction(0, 0x0004, audio_speed);
-    
-    // start the control channel
-    dma_start_channel_mask(1u << ctrl_chan) ;
-    PT_YIELD_usec(375000);
-    dma_channel_abort(data_chan);
-
-    // End game screen
-    EndGame();
-    // Hold while button not pressed
-    while(gpio_get(15)) {
-      
+// Music timer fraction denominators, by tempo step
+static const uint16_t music_tempo[3] = {0xffff, 0xd903, 0xc350};
+
+// What the music thread last acted on
+typedef struct
+{
+  enum game_state state;
+  unsigned int level;
+} Music;
+
+// Plays the music and death crash as the game state changes, and speeds
+// the music up with music_level. Parked until one of them changes.
+static PT_THREAD (protothread_music(struct pt *pt, void *ctx))
+{
+    Music *music = ctx;
+    PT_BEGIN(pt);
+
+    while(1) {
+      PT_WAIT_EVENT(pt, state_waiters, state != music->state || music_level != music->level);
+      if (state != music->state) {
+        music->state = state;
+        music->level = music_level;
+        if (state == STATE_PLAY) {
+          // Start audio, looping the music
+          dma_timer_set_fraction(0, 0x0004, music_tempo[music->level]);
+          audio_play(audio_cropped_8bit, array_size, true) ;
+          sfx_play(SFX_MENU_SELECT) ;
+        }
+        else if (state == STATE_CRASH) {
+          // End music and play the death crash once
+          dma_timer_set_fraction(0, 0x0004, music_tempo[0]);
+          audio_play(death_crash_cropped, death_array_size, false) ;
+        }
+      }
+      else {
+        music->level = music_level;
+        dma_timer_set_fraction(0, 0x0004, music_tempo[music->level]);
+      }
+    }
+
+    PT_END(pt);
+}
+
+#ifdef AUTOPILOT
+// Steers every player with the autopilot, released every other tick
+static PT_THREAD (protothread_bot(struct pt *pt))
+{
+    uint32_t view;
+    PT_BEGIN(pt);
+
+    while(1) {
+      PT_WAIT_EVENT(pt, state_waiters, state == STATE_PLAY);
+      // Ask for a view of the game, and park until it comes
+      view = (uint32_t)(uintptr_t) &bot_view;
+      pt_queue_push(&bot_free, &view, 1);
+      PT_QUEUE_WAIT_DATA(pt, &bot_ready, 1);
+      pt_queue_pop(&bot_ready, &view, 1);
+      for (unsigned int n = 0; n < bot_view.players; n++) {
+        input_drive_stick(n, bot_steer(&bot_view, n));
+      }
+      PT_YIELD(pt);
     }
-    // Reset necessary parameters and flags, and player positions
-    start = 1;
-    reset = 1;
-    endgame = 0;
-    player1win = 0;
-    player2win = 0;
-    player1.xpos = 100;
-    player1.ypos = 210;
-    player2.xpos = 100;
-    player2.ypos = 240;
-    // Check for button press and release
-    while(!gpio_get(15)) {
 
+    PT_END(pt);
+}
+
+// What the soak log has reported so far
+typedef struct
+{
+  Game *game;
+  bool playing;
+  unsigned int games;
+  // Barriers passed at the last line, and the counters then
+  unsigned int logged;
+  unsigned int overruns;
+  unsigned int stalls;
+  unsigned int missed;
+} Soak;
+
+// Logs how the game holds up as it gets faster, every 5 barriers: speed
+// and tunnel height, the longest frame draw, and since the last line the
+// worst release delay of the simulation thread, its dropped releases,
+// its stalls past SIM_MAX_TICKS and the missed deadlines on its core.
+// Released every 100 ms.
+static PT_THREAD (protothread_soak(struct pt *pt, void *ctx))
+{
+    Soak *soak = ctx;
+    struct ptx *sim = &(SIM_CORE ? pt_thread_list1 : pt_thread_list)[sim_thread];
+    PT_BEGIN(pt);
+
+    while(1) {
+      if (!soak->playing && state == STATE_PLAY) {
+        soak->playing = true;
+        soak->games++;
+        soak->logged = barriers_passed;
+        soak->overruns = sim->overruns;
+        soak->stalls = sim_stalls;
+        soak->missed = pt_missed_deadlines[SIM_CORE];
+        sim->jitter_max = 0;
+        render_max_us = 0;
+      }
+      if (soak->playing && barriers_passed >= soak->logged + 5) {
+        fix15 speed = soak->game->barriers.speed;
+        printf("soak: barrier %u, speed %u.%02u px/frame, tunnel %d: frame max %u us, "
+               "tick late max %u us, %u overruns, %u stalls, %u missed\n",
+               barriers_passed,
+               (unsigned int)(((long long) speed * TUNED_FRAME_US / SIM_TICK_US) >> 15),
+               (unsigned int)((((long long) speed * 100 * TUNED_FRAME_US / SIM_TICK_US) >> 15) % 100),
+               LevelBarrier(soak->game->barriers.seed, barriers_passed).tunnel_height,
+               render_max_us, sim->jitter_max, sim->overruns - soak->overruns,
+               sim_stalls - soak->stalls, pt_missed_deadlines[SIM_CORE] - soak->missed);
+        soak->logged = barriers_passed;
+        soak->overruns = sim->overruns;
+        soak->stalls = sim_stalls;
+        soak->missed = pt_missed_deadlines[SIM_CORE];
+        sim->jitter_max = 0;
+        render_max_us = 0;
+      }
+      if (soak->playing && state != STATE_PLAY) {
+        soak->playing = false;
+        printf("soak: game %u over at barrier %u, course seed %08x\n",
+               soak->games, barriers_passed, (unsigned int) soak->game->barriers.seed);
+      }
+      PT_YIELD(pt);
     }
-    // Black out screen on button release
-    fillRect(0,0,640,480,BLACK);
-    
+
     PT_END(pt);
-} // animation thread
+}
+#endif
 
 
 // ========================================
@@ -780,45 +1186,44 @@ int main(){
   // initialize VGA
   initVGA() ;
 
-  // Initialize joystick 1 GPIO pins
-  gpio_init(10);
-  gpio_init(11);
-  gpio_init(12);
-  gpio_init(13);
-
-  gpio_set_dir(10, GPIO_IN);
-  gpio_set_dir(11, GPIO_IN);
-  gpio_set_dir(12, GPIO_IN);
-  gpio_set_dir(13, GPIO_IN);
-  
-  gpio_pull_up(10);
-  gpio_pull_up(11);
-  gpio_pull_up(12);
-  gpio_pull_up(13);
-
-  // Initialize joystick 2 GPIO pins (plug in backwards)
-  gpio_init(6);
-  gpio_init(7);
-  gpio_init(8);
-  gpio_init(9);
-
-  gpio_set_dir(6, GPIO_IN);
-  gpio_set_dir(7, GPIO_IN);
-  gpio_set_dir(8, GPIO_IN);
-  gpio_set_dir(9, GPIO_IN);
-  
-  gpio_pull_up(6);
-  gpio_pull_up(7);
-  gpio_pull_up(8);
-  gpio_pull_up(9);
-  
-  // Initialize button
-  gpio_init(15);
-  gpio_set_dir(15, GPIO_IN);
-  gpio_pull_up(15);
-
-  // add threads
-  pt_add_thread(protothread_anim);
+  // Initialize joystick and button GPIO pins
+  input_init(player_pins, count_of(player_pins), 1u << BUTTON_PIN);
+  // Button events for the menu and end screen, from edge IRQs on core 0
+  pt_gpio_init(MENU_PINS);
+
+  // The frame passes between the simulation and the renderer
+  ringq_init(&frame_free, frame_free_buf, count_of(frame_free_buf), false) ;
+  ringq_init(&frame_ready, frame_ready_buf, count_of(frame_ready_buf), false) ;
+#ifdef AUTOPILOT
+  ringq_init(&bot_free, bot_free_buf, count_of(bot_free_buf), false) ;
+  ringq_init(&bot_ready, bot_ready_buf, count_of(bot_ready_buf), false) ;
+#endif
+
+  // add threads, each released at its own rate, see game threads
+  static Game game ;
+  static Render render = {.particle_budget = PARTICLE_BUDGET_MAX} ;
+  static Menu menu = {&game, &render} ;
+  static Music music ;
+  static LoadReport load ;
+  particles_init(&render.particles, rng_rosc_seed()) ;
+  starfield_init(&render.stars, STARFIELD_STARS, rng_rosc_seed()) ;
+  pt_sched_method = SCHED_RATE ;
+  pt_add_thread_on(SIM_CORE, protothread_input, SIM_TICK_US, 4);
+  sim_thread = pt_add_thread_ctx_on(SIM_CORE, protothread_sim, &game, SIM_TICK_US, 3);
+  pt_add_thread_ctx_on(SIM_CORE, protothread_menu, &menu, 33000, 1);
+  pt_add_thread_ctx_on(RENDER_CORE, protothread_render, &render, 33000, 3);
+  pt_add_thread_on(RENDER_CORE, protothread_hud, 100000, 1);
+  pt_add_thread_ctx_on(1, protothread_music, &music, 10000, 2);
+  pt_add_thread_ctx_on(1, protothread_load, &load, 5000000, 1);
+#ifdef PT_PROFILE
+  pt_add_thread_on(1, protothread_profile, 100000, 1);
+#endif
+#ifdef AUTOPILOT
+  // The search runs on core 1, off the simulation's core
+  static Soak soak = {&game} ;
+  pt_add_thread_on(1, protothread_bot, 2 * SIM_TICK_US, 2);
+  pt_add_thread_ctx_on(1, protothread_soak, &soak, 100000, 1);
+#endif
 
 
 
@@ -827,6 +1232,9 @@ int main(){
   //////////////////////////////////////////////////
 
   
+  // The DAC is on SPI0, fitted only for the SPI sink: the PWM build
+  // leaves these pins alone
+#if AUDIO_SINK == AUDIO_SINK_SPI
   // Initialize SPI channel (channel, baud rate set to 20MHz)
   spi_init(SPI_PORT, 20000000) ;
 
@@ -838,8 +1246,23 @@ int main(){
   gpio_set_function(PIN_CS, GPIO_FUNC_SPI) ;
   gpio_set_function(PIN_SCK, GPIO_FUNC_SPI);
   gpio_set_function(PIN_MOSI, GPIO_FUNC_SPI);
+#endif
+
+#ifdef RUN_BENCHMARKS
+  // Give a USB terminal time to connect
+  sleep_ms(3000) ;
+  // These use core 1, so they run before it is started for the game
+  bench_pt_run_all() ;
+#endif
+
+  // Start core 1, which brings up audio before it starts its scheduler
+  pt_launch_core1(core1_init) ;
+
+#ifdef RUN_BENCHMARKS
+  bench_run_all() ;
+#endif
 
-  // start scheduler
+  // start core 0 scheduler
   pt_schedule_start ;
   
   
@@ -295,6 +295,7 @@ struct pt {
   do {            \
     LC_SET((pt)->lc);       \
     if(!(condition)) {        \
+      PT_POLL_MISS();         \
       return PT_WAITING;      \
     }           \
   } while(0)
@@ -459,8 +460,12 @@ struct pt {
   do {            \
     PT_YIELD_FLAG = 0;        \
     LC_SET((pt)->lc);       \
-    if((PT_YIELD_FLAG == 0) || !(cond)) { \
-      return PT_YIELDED;                        \
+    if(PT_YIELD_FLAG == 0) {      \
+      return PT_YIELDED;      \
+    }           \
+    if(!(cond)) {       \
+      PT_POLL_MISS();         \
+      return PT_YIELDED;      \
     }           \
   } while(0)
 
@@ -475,6 +480,9 @@ struct pt {
 
 struct pt_sem {
   unsigned int count;
+  volatile unsigned int waiters; // threads parked on the semaphore
+  spin_lock_t *lock;             // SAFE versions: this semaphore's spinlock
+  unsigned int contention;       // SAFE versions: times the lock was already taken
 };
 
 /**
@@ -494,7 +502,7 @@ struct pt_sem {
 // NOTE that the default semaphore is not
 // multi-core safe, but is OK one one core
 
-#define PT_SEM_INIT(s, c) (s)->count = c
+#define PT_SEM_INIT(s, c) do{ (s)->count = c ; (s)->waiters = 0 ; } while(0)
 
 /**
  * Wait for a semaphore
@@ -514,7 +522,7 @@ struct pt_sem {
  */
 #define PT_SEM_WAIT(pt, s)  \
   do {            \
-    PT_YIELD_UNTIL(pt, (s)->count > 0);   \
+    PT_WAIT_EVENT(pt, (s)->waiters, (s)->count > 0);   \
     --(s)->count;       \
   } while(0)
 
@@ -533,7 +541,7 @@ struct pt_sem {
  *
  * \hideinitializer
  */
-#define PT_SEM_SIGNAL(pt, s) ++(s)->count
+#define PT_SEM_SIGNAL(pt, s) do{ ++(s)->count ; pt_wake(&(s)->waiters) ; } while(0)
 
 #endif /* __PT_SEM_H__ */
 
@@ -542,24 +550,61 @@ struct pt_sem {
 //=====================================================================
 
 // macro to make a thread execution pause in usec
-// max time of about one hour
+// max time of about half an hour
+// the thread is parked, not polled, until the time is up
+// a negative delay counts as a missed deadline and just yields once
+// the deadline is kept in a static at the call site, so reentrant (ctx)
+// threads must use PT_SLEEP_usec with a field of their context instead
 #define PT_YIELD_usec(delay_time)  \
-    do { static unsigned int time_thread ;\
-    time_thread = timer_hw->timerawl + (unsigned int)delay_time ; \
-    PT_YIELD_UNTIL(pt, (timer_hw->timerawl >= time_thread)); \
+    do { static unsigned long long time_thread ;\
+    PT_SLEEP_usec(pt, delay_time, time_thread); \
     } while(0);
 
+// PT_YIELD_usec with the deadline in wake_time, an unsigned long long
+// lvalue that keeps its value across the wait (a ctx field)
+#define PT_SLEEP_usec(pt, delay_time, wake_time)  \
+    do { \
+    (wake_time) = pt_time_us() + (long long)(int)(delay_time) ; \
+    PT_YIELD_UNTIL_TIME(pt, wake_time); \
+    } while(0)
+
+// yield, then stay parked until the 64-bit time wake_time (usec)
+// wake_time must keep its value while the thread is parked
+#define PT_YIELD_UNTIL_TIME(pt, wake_time) \
+  do { \
+    PT_YIELD_FLAG = 0; \
+    pt_sleep_until(wake_time, 1); \
+    LC_SET((pt)->lc); \
+    if (PT_YIELD_FLAG == 0) { \
+      return PT_YIELDED; \
+    } \
+    if (pt_time_us() < (wake_time)) { \
+      pt_sleep_until(wake_time, 0); \
+      return PT_YIELDED; \
+    } \
+  } while(0)
+
 // macro to return system time
 #define PT_GET_TIME_usec() (timer_hw->timerawl)
+// 64-bit system time, never wraps
+#define PT_GET_TIME64_usec() pt_time_us()
 
 // macros for interval yield
-// attempts to make interval equal to specified value
-#define PT_INTERVAL_INIT() static unsigned int pt_interval_marker
+// releases are exactly interval_time apart, without drift; a thread
+// that falls a whole interval behind counts a missed deadline and
+// starts again from now
+// the marker is a static, so these are for threads without a ctx
+#define PT_INTERVAL_INIT() static unsigned long long pt_interval_marker
 //
 #define PT_YIELD_INTERVAL(interval_time)  \
     do { \
-    PT_YIELD_UNTIL(pt, (timer_hw->timerawl >= pt_interval_marker)); \
-    pt_interval_marker = timer_hw->timerawl + (unsigned int)interval_time; \
+    if (pt_interval_marker == 0) pt_interval_marker = pt_time_us() + (interval_time); \
+    PT_YIELD_UNTIL_TIME(pt, pt_interval_marker); \
+    pt_interval_marker += (interval_time); \
+    if (pt_interval_marker <= pt_time_us()) { \
+      pt_missed_deadlines[get_core_num()]++; \
+      pt_interval_marker = pt_time_us() + (interval_time); \
+    } \
     } while(0);
 //
 // =================================================================
@@ -568,32 +613,53 @@ struct pt_sem {
 // NOTE that the default semaphore is not
 // multi-core safe, but is OK one one core
 // The SAFE versions work across cores, but have more overhead
+// Each semaphore claims its own spinlock the first time it is
+// initialized, so unrelated semaphores don't serialize on one lock.
+// NOTE there are only 8 claimable spinlocks for the whole program
+
+// take the semaphore's lock, counting the times it was already taken
+static inline void pt_sem_lock(struct pt_sem *s) {
+  // reading a spinlock register takes it if it is free
+  if (*(s)->lock == 0) {
+    spin_lock_unsafe_blocking((s)->lock);
+    (s)->contention++ ;
+  }
+  else {
+    __mem_fence_acquire();
+  }
+}
 
-spin_lock_t * sem_lock ;
+#define pt_sem_unlock(s) spin_unlock_unsafe((s)->lock)
 
+// set (s)->lock before the first init to share a lock between semaphores
 #define PT_SEM_SAFE_INIT(s,c) do{ \
-  sem_lock = spin_lock_init(25); \
-  spin_lock_unsafe_blocking (sem_lock); \
+  if ((s)->lock == NULL) (s)->lock = spin_lock_instance(spin_lock_claim_unused(true)); \
+  spin_lock_unsafe_blocking ((s)->lock); \
   (s)->count = c ; \
-  spin_unlock_unsafe (sem_lock); \
+  (s)->waiters = 0 ; \
+  (s)->contention = 0 ; \
+  spin_unlock_unsafe ((s)->lock); \
 } while(0)
 
+// parks on the semaphore while the count is zero
 #define PT_SEM_SAFE_WAIT(pt,s)  do {  \
-    spin_lock_unsafe_blocking (sem_lock);   \
     PT_YIELD_FLAG = 0;      \
     LC_SET((pt)->lc);       \
+    pt_sem_lock(s);         \
     if((PT_YIELD_FLAG == 0) || !((s)->count > 0)) { \
-      spin_unlock_unsafe (sem_lock);  \
+      if ((s)->count == 0) pt_park(&(s)->waiters); \
+      pt_sem_unlock(s);     \
       return PT_YIELDED;      \
     }   \
     --(s)->count; \
-    spin_unlock_unsafe (sem_lock);  \
+    pt_sem_unlock(s);       \
   } while(0)
 
 #define PT_SEM_SAFE_SIGNAL(pt,s) do{ \
-    spin_lock_unsafe_blocking (sem_lock); \
+    pt_sem_lock(s); \
     ++(s)->count ; \
-    spin_unlock_unsafe (sem_lock) ; \
+    pt_sem_unlock(s) ; \
+    pt_wake(&(s)->waiters) ; \
 } while(0)
 
 // ==================================================================
@@ -606,16 +672,26 @@ spin_lock_t * lock_lock ;
 // general pattern will be to lock lock_lock
 // do specific lock operation (on another spin_lock)
 // unlock lock_lock
-// NOTE vaild lock_num are from 26-31 total of SIX hardware locks!
+// Both locks are claimed from the SDK's pool of free spinlocks, which the
+// SAFE semaphores, the wait queues, serial, audio and the multi-producer
+// queues also claim from, so no two users share a lock. Call from one
+// core before the other starts.
 
-#define PT_LOCK_INIT(s,lock_num,lock_state) do{ \
-  lock_lock = spin_lock_init(24); \
+#define PT_LOCK_CLAIM(s,lock_state) do{ \
+  if (lock_lock == NULL) lock_lock = spin_lock_init(spin_lock_claim_unused(true)); \
   spin_lock_unsafe_blocking (lock_lock); \
-  s = spin_lock_init((uint)lock_num); \
+  s = spin_lock_init(spin_lock_claim_unused(true)); \
   if(lock_state) spin_lock_unsafe_blocking (s); \
   spin_unlock_unsafe (lock_lock) ; \
 } while(0)
 
+// Deprecated: the lock number can no longer be chosen, so a caller that
+// relied on it gets a build warning rather than a different lock
+#define PT_LOCK_INIT(s,lock_num,lock_state) do{ \
+  _Pragma("GCC warning \"PT_LOCK_INIT ignores lock_num; use PT_LOCK_CLAIM\"") \
+  PT_LOCK_CLAIM(s,lock_state) ; \
+} while(0)
+
 #define PT_LOCK_WAIT(pt,s)  do {  \
   spin_lock_unsafe_blocking (lock_lock); \
   PT_YIELD_FLAG = 0;        \
@@ -639,9 +715,10 @@ spin_lock_t * lock_lock ;
     multicore_fifo_push_blocking(data) ; \
 } while(0)
 
+// parks until the SIO FIFO IRQ says there is data
 #define PT_FIFO_READ(fifo_out)  \
 do{ \
-    PT_YIELD_UNTIL(pt, multicore_fifo_rvalid()==true); \
+    PT_WAIT_EVENT(pt, pt_fifo_waiters[get_core_num()], pt_fifo_rvalid_armed()); \
     fifo_out = multicore_fifo_pop_blocking() ; \
 } while(0) 
 
@@ -665,11 +742,224 @@ static struct pt pt_sched1 ;
 int pt_task_count = 0 ;
 int pt_task_count1 = 0 ;
 
+//====================================================================
+// 64-bit timebase and timer wheel
+// The 64-bit microsecond timer doesn't wrap for half a million years, so
+// deadlines are 64-bit times compared directly.
+static inline unsigned long long pt_time_us(void) {
+  return time_us_64() ;
+}
+
+// Hierarchical timer wheel: 4 levels of 64 slots with 64 usec ticks, so
+// level l holds timeouts up to 64^(l+1) ticks away (4 ms, 262 ms, 16.8 s,
+// 17.9 min) and longer ones wait in an overflow list. Adding or removing
+// a timer is O(1). Advancing visits only the slots that are due, plus one
+// slot per level when a lower level completes a rotation (the cascade).
+// A timer fires in the first tick that starts at or after its deadline,
+// so it is up to 64 usec late, never early.
+#define PT_WHEEL_TICK_SHIFT 6
+#define PT_WHEEL_BITS 6
+#define PT_WHEEL_SLOTS (1 << PT_WHEEL_BITS)
+#define PT_WHEEL_MASK (PT_WHEEL_SLOTS - 1)
+#define PT_WHEEL_LEVELS 4
+#define PT_WHEEL_OVERFLOW 0xff
+
+struct pt_timer {
+  struct pt_timer *next, **pprev;   // list links
+  unsigned long long expires;       // usec
+  unsigned long long tick;          // expires rounded up to a tick
+  void (*fire)(struct pt_timer *t, unsigned long long now);
+  int arg;
+  unsigned char queued;
+  unsigned char level, slot;
+};
+
+struct pt_wheel {
+  unsigned long long now_tick;                       // next tick to process
+  struct pt_timer *slot[PT_WHEEL_LEVELS][PT_WHEEL_SLOTS];
+  unsigned long long occupied[PT_WHEEL_LEVELS];      // bit per non-empty slot
+  struct pt_timer *overflow;
+  unsigned int pending;
+};
+
+// put t in the slot for its tick, relative to now_tick
+static void pt_wheel_place(struct pt_wheel *w, struct pt_timer *t) {
+  unsigned long long at = (t->tick > w->now_tick) ? t->tick : w->now_tick ;
+  unsigned long long delta = at - w->now_tick ;
+  struct pt_timer **head ;
+  int level ;
+  for (level=0; level<PT_WHEEL_LEVELS; level++) {
+    if (delta < (1ull << (PT_WHEEL_BITS * (level + 1)))) break ;
+  }
+  if (level == PT_WHEEL_LEVELS) {
+    t->level = PT_WHEEL_OVERFLOW ;
+    head = &w->overflow ;
+  }
+  else {
+    t->level = level ;
+    t->slot = (at >> (PT_WHEEL_BITS * level)) & PT_WHEEL_MASK ;
+    head = &w->slot[level][t->slot] ;
+    w->occupied[level] |= 1ull << t->slot ;
+  }
+  t->next = *head ;
+  if (t->next) t->next->pprev = &t->next ;
+  t->pprev = head ;
+  *head = t ;
+}
+
+void pt_timer_cancel(struct pt_wheel *w, struct pt_timer *t) {
+  if (!t->queued) return ;
+  *t->pprev = t->next ;
+  if (t->next) t->next->pprev = t->pprev ;
+  if (t->level != PT_WHEEL_OVERFLOW && w->slot[t->level][t->slot] == NULL) {
+    w->occupied[t->level] &= ~(1ull << t->slot) ;
+  }
+  t->queued = 0 ;
+  w->pending-- ;
+}
+
+// (re)arm t to fire at expires, now is the current time
+void pt_timer_add(struct pt_wheel *w, struct pt_timer *t, unsigned long long expires,
+                  unsigned long long now) {
+  pt_timer_cancel(w, t) ;
+  // an empty wheel can jump straight to the present
+  if (w->pending == 0) w->now_tick = now >> PT_WHEEL_TICK_SHIFT ;
+  t->expires = expires ;
+  t->tick = (expires + (1u << PT_WHEEL_TICK_SHIFT) - 1) >> PT_WHEEL_TICK_SHIFT ;
+  pt_wheel_place(w, t) ;
+  t->queued = 1 ;
+  w->pending++ ;
+}
+
+// bring down the slot of a level (PT_WHEEL_LEVELS for the overflow list)
+// that is due at now_tick
+static void pt_wheel_cascade(struct pt_wheel *w, int level) {
+  struct pt_timer *t, *next ;
+  if (level == PT_WHEEL_LEVELS) {
+    t = w->overflow ;
+    w->overflow = NULL ;
+  }
+  else {
+    int idx = (w->now_tick >> (PT_WHEEL_BITS * level)) & PT_WHEEL_MASK ;
+    t = w->slot[level][idx] ;
+    w->slot[level][idx] = NULL ;
+    w->occupied[level] &= ~(1ull << idx) ;
+  }
+  for (; t; t = next) {
+    next = t->next ;
+    pt_wheel_place(w, t) ;
+  }
+}
+
+// fire every timer that is due at time now
+void pt_wheel_advance(struct pt_wheel *w, unsigned long long now) {
+  unsigned long long target = now >> PT_WHEEL_TICK_SHIFT ;
+  while (w->now_tick <= target) {
+    if (w->pending == 0) {
+      w->now_tick = target + 1 ;
+      return ;
+    }
+    int idx = w->now_tick & PT_WHEEL_MASK ;
+    if (idx == 0) {
+      // start of a rotation: cascade every level whose rotation also ends
+      int top = 1, level ;
+      while (top < PT_WHEEL_LEVELS &&
+             (w->now_tick & ((1ull << (PT_WHEEL_BITS * (top + 1))) - 1)) == 0) top++ ;
+      for (level=top; level>=1; level--) pt_wheel_cascade(w, level) ;
+    }
+    unsigned long long bits = w->occupied[0] >> idx ;
+    if (bits == 0) {
+      // nothing else this rotation
+      unsigned long long next = w->now_tick + (PT_WHEEL_SLOTS - idx) ;
+      w->now_tick = (next <= target) ? next : target + 1 ;
+      continue ;
+    }
+    int skip = __builtin_ctzll(bits) ;
+    if (w->now_tick + skip > target) {
+      w->now_tick = target + 1 ;
+      return ;
+    }
+    w->now_tick += skip ;
+    idx += skip ;
+    struct pt_timer *t = w->slot[0][idx], *next ;
+    w->slot[0][idx] = NULL ;
+    w->occupied[0] &= ~(1ull << idx) ;
+    // past this tick first, so a timer re-added by fire lands in the next one
+    w->now_tick++ ;
+    for (; t; t = next) {
+      next = t->next ;
+      t->queued = 0 ;
+      w->pending-- ;
+      t->fire(t, now) ;
+    }
+  }
+}
+
+// first tick at or after base (a multiple of this level's tick) when an
+// occupied slot of the level comes due
+static unsigned long long pt_wheel_first(unsigned long long occupied, unsigned long long base, int level) {
+  int b = (base >> (PT_WHEEL_BITS * level)) & PT_WHEEL_MASK ;
+  unsigned long long rot = b ? (occupied >> b) | (occupied << (PT_WHEEL_SLOTS - b)) : occupied ;
+  return base + ((unsigned long long)__builtin_ctzll(rot) << (PT_WHEEL_BITS * level)) ;
+}
+
+// earliest time pt_wheel_advance has something to do, false if no timers
+bool pt_wheel_next(struct pt_wheel *w, unsigned long long *when) {
+  unsigned long long tick = ~0ull ;
+  int level ;
+  if (w->pending == 0) return false ;
+  for (level=0; level<=PT_WHEEL_LEVELS; level++) {
+    unsigned long long span = 1ull << (PT_WHEEL_BITS * level) ;
+    unsigned long long base = (w->now_tick + span - 1) & ~(span - 1) ;
+    unsigned long long t ;
+    if (level == PT_WHEEL_LEVELS) {
+      if (w->overflow == NULL) continue ;
+      t = base ;
+    }
+    else {
+      if (w->occupied[level] == 0) continue ;
+      t = pt_wheel_first(w->occupied[level], base, level) ;
+    }
+    if (t < tick) tick = t ;
+  }
+  *when = tick << PT_WHEEL_TICK_SHIFT ;
+  return true ;
+}
+
+// one wheel per core for the sleeping threads
+static struct pt_wheel pt_wheel[2] ;
+
+// deadlines that had already passed when a thread asked to wait for
+// them, per core (see also ptx.missed), and the latest wake seen
+unsigned int pt_missed_deadlines[2] ;
+unsigned int pt_wake_late_max[2] ;
+
 // The task structure
 struct ptx {
   struct pt pt;              // thread context
   int num;                    // thread number
   char (*pf)(struct pt *pt); // pointer to thread function
+  // reentrant threads (see pt_add_ctx) are called with their context
+  char (*pfc)(struct pt *pt, void *ctx);
+  void *ctx;
+  // used by SCHED_RATE only
+  unsigned int period;       // usec between releases, 0 for a background thread
+  int priority;              // higher runs first when several are due
+  unsigned int release;      // time of the next release
+  unsigned int runs;         // releases dispatched
+  unsigned int overruns;     // releases dropped after falling a whole period behind
+  unsigned int jitter_max;   // worst release-to-dispatch delay, usec
+  unsigned int jitter_sum;   // total release-to-dispatch delay, for the average
+  // time waits
+  struct pt_timer timer;     // wakes the thread from PT_YIELD_UNTIL_TIME
+  unsigned int missed;       // deadlines already past when it asked to wait
+#ifdef PT_PROFILE
+  // runtime accounting, see pt_run
+  unsigned int prof_calls;
+  unsigned long long prof_total_us;
+  unsigned int prof_max_us;
+  unsigned int prof_reason[5]; // see PT_PROF_PARKED
+#endif
 };
 
 // === extended structure for scheduler ===============
@@ -679,46 +969,499 @@ static struct ptx pt_thread_list[MAX_THREADS];
 // core 1
 static struct ptx pt_thread_list1[MAX_THREADS];
 
+// === wait queues ===================================
+// Each core keeps a mask of its threads that are ready to run, and the
+// schedulers only call those. A thread waiting on something parks: it
+// leaves the ready mask, and whoever makes its condition true (another
+// thread, an IRQ handler, or the scheduler for time waits) puts it back.
+// A wait queue is just a volatile unsigned int of waiting threads,
+// bit n for thread n on core 0 and bit 16+n for thread n on core 1.
+
+volatile unsigned int pt_ready[2] ;
+// thread being run by each core's scheduler, -1 for none
+int pt_current[2] = {-1, -1} ;
+// protects the ready masks and the wait queues
+spin_lock_t * pt_wait_lock ;
+
+// measurement: scheduler passes, and checks of a polled condition
+// (PT_WAIT_UNTIL, PT_YIELD_UNTIL) that found it still false
+unsigned int pt_sched_passes[2] ;
+unsigned int pt_wasted_polls[2] ;
+#define PT_POLL_MISS() (pt_wasted_polls[get_core_num()]++)
+
+// set for threads that sat out releases while parked (SCHED_RATE)
+static unsigned int pt_was_parked[2] ;
+
+// take the current thread out of the ready mask and add it to a queue
+void pt_park(volatile unsigned int *waiters) {
+  int core = get_core_num() ;
+  if (pt_current[core] < 0) return ; // not run by a scheduler: it polls
+  unsigned int bit = 1u << pt_current[core] ;
+  uint32_t irq_state = spin_lock_blocking(pt_wait_lock) ;
+  pt_ready[core] &= ~bit ;
+  pt_was_parked[core] |= bit ;
+  *waiters |= bit << (16 * core) ;
+  spin_unlock(pt_wait_lock, irq_state) ;
+}
+
+// undo pt_park, when the condition came true before the thread returned
+void pt_unpark(volatile unsigned int *waiters) {
+  int core = get_core_num() ;
+  if (pt_current[core] < 0) return ;
+  unsigned int bit = 1u << pt_current[core] ;
+  uint32_t irq_state = spin_lock_blocking(pt_wait_lock) ;
+  pt_ready[core] |= bit ;
+  *waiters &= ~(bit << (16 * core)) ;
+  spin_unlock(pt_wait_lock, irq_state) ;
+}
+
+// make every thread in a queue ready, from a thread or an IRQ handler on
+// either core
+void pt_wake(volatile unsigned int *waiters) {
+  // nothing parked yet (also the case before the schedulers exist)
+  if (*waiters == 0) return ;
+  uint32_t irq_state = spin_lock_blocking(pt_wait_lock) ;
+  unsigned int w = *waiters ;
+  *waiters = 0 ;
+  pt_ready[0] |= w & 0xffff ;
+  pt_ready[1] |= w >> 16 ;
+  spin_unlock(pt_wait_lock, irq_state) ;
+  // end an idle WFE on the other core
+  __sev() ;
+}
+
+// === running a thread =================================
+// Every scheduler calls threads through pt_run. With PT_PROFILE defined
+// (cmake -DPROJECT_PROFILE=ON) it also counts calls, run time from the
+// 1 MHz timer (two register reads per call) and why each call returned:
+// the PT_WAITING..PT_ENDED return value, or PT_PROF_PARKED if the thread
+// left the ready mask to wait. Without it, pt_run is just the call.
+#define PT_PROF_PARKED 4
+
+#ifdef PT_PROFILE
+// start of the profiling window, see pt_profile_reset
+static unsigned int pt_profile_start ;
+
+static inline char pt_run(int core, struct ptx *ptx) {
+  unsigned int start = timer_hw->timerawl ;
+  pt_current[core] = ptx->num ;
+  char ret = ptx->pfc ? (ptx->pfc)(&ptx->pt, ptx->ctx) : (ptx->pf)(&ptx->pt) ;
+  unsigned int elapsed = timer_hw->timerawl - start ;
+  ptx->prof_calls++ ;
+  ptx->prof_total_us += elapsed ;
+  if (elapsed > ptx->prof_max_us) ptx->prof_max_us = elapsed ;
+  if (!(pt_ready[core] & (1u << ptx->num))) ptx->prof_reason[PT_PROF_PARKED]++ ;
+  else if ((unsigned char)ret < PT_PROF_PARKED) ptx->prof_reason[(unsigned char)ret]++ ;
+  return ret ;
+}
+#else
+static inline char pt_run(int core, struct ptx *ptx) {
+  pt_current[core] = ptx->num ;
+  if (ptx->pfc) return (ptx->pfc)(&ptx->pt, ptx->ctx) ;
+  return (ptx->pf)(&ptx->pt) ;
+}
+#endif
+
+// timer wheel callback: a sleeping thread's time is up
+static void pt_timer_wake(struct pt_timer *t, unsigned long long now) {
+  int core = get_core_num() ;
+  unsigned int late = (unsigned int)(now - t->expires) ;
+  if (late > pt_wake_late_max[core]) pt_wake_late_max[core] = late ;
+  uint32_t irq_state = spin_lock_blocking(pt_wait_lock) ;
+  pt_ready[core] |= 1u << t->arg ;
+  spin_unlock(pt_wait_lock, irq_state) ;
+}
+
+// park the current thread until wake_time. first is set on the call
+// that starts the wait, where a deadline already past counts as missed.
+void pt_sleep_until(unsigned long long wake_time, int first) {
+  int core = get_core_num() ;
+  unsigned long long now = pt_time_us() ;
+  if (wake_time <= now) {
+    if (first) {
+      pt_missed_deadlines[core]++ ;
+      if (pt_current[core] >= 0) {
+        (core ? pt_thread_list1 : pt_thread_list)[pt_current[core]].missed++ ;
+      }
+    }
+    return ;
+  }
+  if (pt_current[core] < 0) return ; // not run by a scheduler: it polls
+  struct ptx *ptx = &(core ? pt_thread_list1 : pt_thread_list)[pt_current[core]] ;
+  unsigned int bit = 1u << pt_current[core] ;
+  uint32_t irq_state = spin_lock_blocking(pt_wait_lock) ;
+  pt_ready[core] &= ~bit ;
+  pt_was_parked[core] |= bit ;
+  spin_unlock(pt_wait_lock, irq_state) ;
+  // only this core touches its wheel
+  pt_timer_add(&pt_wheel[core], &ptx->timer, wake_time, now) ;
+}
+
+// called by the scheduler: ready the sleepers whose time is up
+static inline void pt_wake_sleepers(int core) {
+  if (pt_wheel[core].pending) pt_wheel_advance(&pt_wheel[core], pt_time_us()) ;
+}
+
+// Park until cond is true. waiters is the wait queue that whatever makes
+// cond true passes to pt_wake. cond is checked again after parking so a
+// wake between the check and the park is not lost.
+#define PT_WAIT_EVENT(pt, waiters, cond) \
+  do { \
+    LC_SET((pt)->lc); \
+    if (!(cond)) { \
+      pt_park(&(waiters)); \
+      if (!(cond)) { \
+        return PT_WAITING; \
+      } \
+      pt_unpark(&(waiters)); \
+    } \
+  } while(0)
+
+// no deadline, for PT_WAIT_EVENT_UNTIL
+#define PT_FOREVER (~0ull)
+
+// park the current thread on waiters until a wake or the 64-bit time
+// deadline, returns false without parking if the deadline has passed
+static bool pt_park_until(volatile unsigned int *waiters, unsigned long long deadline) {
+  int core = get_core_num() ;
+  unsigned long long now = pt_time_us() ;
+  if (deadline <= now) return false ;
+  pt_park(waiters) ;
+  if (pt_current[core] >= 0 && deadline != PT_FOREVER) {
+    struct ptx *ptx = &(core ? pt_thread_list1 : pt_thread_list)[pt_current[core]] ;
+    pt_timer_add(&pt_wheel[core], &ptx->timer, deadline, now) ;
+  }
+  return true ;
+}
+
+// a timed wait is over: leave the queue and drop the timer, whichever
+// of the two woke the thread
+static void pt_wait_done(volatile unsigned int *waiters) {
+  int core = get_core_num() ;
+  if (pt_current[core] < 0) return ;
+  pt_unpark(waiters) ;
+  pt_timer_cancel(&pt_wheel[core], &(core ? pt_thread_list1 : pt_thread_list)[pt_current[core]].timer) ;
+}
+
+// PT_WAIT_EVENT that also gives up at the 64-bit time deadline (usec,
+// or PT_FOREVER). Test cond afterwards to tell which happened. deadline
+// is evaluated on every check, so it must keep its value while parked.
+#define PT_WAIT_EVENT_UNTIL(pt, waiters, cond, deadline) \
+  do { \
+    LC_SET((pt)->lc); \
+    if (!(cond) && pt_park_until(&(waiters), (deadline))) { \
+      if (!(cond)) { \
+        return PT_WAITING; \
+      } \
+    } \
+    pt_wait_done(&(waiters)); \
+  } while(0)
+
+// --- SIO FIFO: the FIFO IRQ wakes a reader parked in PT_FIFO_READ ---
+volatile unsigned int pt_fifo_waiters[2] ;
+
+static void pt_fifo_irq(void) {
+  int core = get_core_num() ;
+  // level triggered while there is data, so off until the next wait
+  irq_set_enabled(SIO_IRQ_PROC0 + core, false) ;
+  multicore_fifo_clear_irq() ;
+  pt_wake(&pt_fifo_waiters[core]) ;
+}
+
+// true if there is data, otherwise arm this core's FIFO IRQ
+static bool pt_fifo_rvalid_armed(void) {
+  static bool installed[2] ;
+  int core = get_core_num() ;
+  if (multicore_fifo_rvalid()) return true ;
+  if (!installed[core]) {
+    irq_set_exclusive_handler(SIO_IRQ_PROC0 + core, pt_fifo_irq) ;
+    installed[core] = true ;
+  }
+  irq_set_enabled(SIO_IRQ_PROC0 + core, true) ;
+  return false ;
+}
+
+// --- DMA: a channel's completion IRQ (on DMA_IRQ_1) wakes its waiters ---
+// channel used by the serial TX ring, see serial I/O below
+#define PT_SERIAL_TX_CHAN 5
+volatile unsigned int pt_dma_waiters[NUM_DMA_CHANNELS] ;
+
+static void pt_serial_tx_done(void) ;
+
+static void pt_dma_irq(void) {
+  unsigned int ints = dma_hw->ints1 ;
+  int chan ;
+  dma_hw->ints1 = ints ;
+  for (chan=0; ints; chan++, ints >>= 1) {
+    if (!(ints & 1)) continue ;
+    // the serial TX ring restarts its channel before waking writers
+    if (chan == PT_SERIAL_TX_CHAN) pt_serial_tx_done() ;
+    pt_wake(&pt_dma_waiters[chan]) ;
+  }
+}
+
+static void pt_dma_arm(unsigned int chan) {
+  static bool installed ;
+  if (!installed) {
+    irq_add_shared_handler(DMA_IRQ_1, pt_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY) ;
+    irq_set_enabled(DMA_IRQ_1, true) ;
+    installed = true ;
+  }
+  dma_channel_set_irq1_enabled(chan, true) ;
+}
+
+// park until a DMA channel is done
+#define PT_WAIT_DMA(pt, chan) \
+  do { \
+    pt_dma_arm(chan); \
+    PT_WAIT_EVENT(pt, pt_dma_waiters[chan], !dma_channel_is_busy(chan)); \
+  } while(0)
+
+// --- inter-core queues (ringq.h): pushes and pops wake the other side ---
+// The SIO FIFO carries no data here: a wake is pt_wake's SEV, and the
+// words go through the queue in shared SRAM.
+#include "ringq.h"
+
+static inline unsigned int pt_queue_push(ringq_t *q, const uint32_t *items, unsigned int n) {
+  n = ringq_push(q, items, n) ;
+  if (n) pt_wake(&q->waiters) ;
+  return n ;
+}
+
+static inline unsigned int pt_queue_pop(ringq_t *q, uint32_t *items, unsigned int max) {
+  max = ringq_pop(q, items, max) ;
+  if (max) pt_wake(&q->waiters) ;
+  return max ;
+}
+
+// park until the queue has at least n words, or room for n words
+#define PT_QUEUE_WAIT_DATA(pt, q, n)  PT_WAIT_EVENT(pt, (q)->waiters, ringq_count(q) >= (n))
+#define PT_QUEUE_WAIT_SPACE(pt, q, n) PT_WAIT_EVENT(pt, (q)->waiters, ringq_space(q) >= (n))
+
+// push all n words, parking whenever the queue is full
+// done counts the words pushed so far, an unsigned int lvalue that keeps
+// its value across the wait (a ctx field, or a static in a thread
+// without a ctx)
+#define PT_QUEUE_PUSH(pt, q, items, n, done) \
+  do { \
+    (done) = 0 ; \
+    while ((done) < (n)) { \
+      PT_QUEUE_WAIT_SPACE(pt, q, 1) ; \
+      (done) += pt_queue_push(q, (items) + (done), (n) - (done)) ; \
+    } \
+  } while(0)
+
+// pop between 1 and max words into items, parking until there are some
+#define PT_QUEUE_POP(pt, q, items, max, got) \
+  do { \
+    PT_QUEUE_WAIT_DATA(pt, q, 1) ; \
+    got = pt_queue_pop(q, items, max) ; \
+  } while(0)
+
+// --- GPIO: debounced button events from edge IRQs ---
+// Every edge on a pin given to pt_gpio_init pushes back a settle alarm.
+// Once the pins have been quiet for PT_GPIO_SETTLE_US, the alarm samples
+// them all, and each one that changed queues an event and wakes the
+// waiters, so bounces cost a few IRQs and no thread runs until the
+// button is stable. Buttons are switches to ground: low is pressed.
+// The events are for one consumer thread at a time.
+#define PT_GPIO_SETTLE_US 5000
+#define PT_GPIO_EVENTS 32
+
+// an event word: the GPIO number, the edge, and the time it settled
+// (usec, low 8 bits dropped). 0 is never an event.
+#define PT_GPIO_PRESS   0x20
+#define PT_GPIO_RELEASE 0x40
+#define PT_GPIO_PIN(e)  ((e) & 0x1f)
+#define PT_GPIO_TIME(e) ((e) & ~0xffu)
+
+static ringq_t pt_gpio_events ;
+static uint32_t pt_gpio_events_buf[PT_GPIO_EVENTS] ;
+static uint32_t pt_gpio_mask ;
+static int pt_gpio_alarm = -1 ;
+// debounced state (bit per GPIO, 1 = pressed), and when each pin was
+// last pressed
+static volatile uint32_t pt_gpio_state ;
+static volatile unsigned int pt_gpio_press_time[32] ;
+// raw edge IRQs, to see how much the buttons bounce
+volatile unsigned int pt_gpio_edges ;
+
+static void pt_gpio_edge_irq(void) {
+  uint32_t pins = pt_gpio_mask ;
+  while (pins) {
+    unsigned int pin = __builtin_ctz(pins) ;
+    pins &= pins - 1 ;
+    gpio_acknowledge_irq(pin, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE) ;
+  }
+  pt_gpio_edges++ ;
+  // writing the alarm re-arms it, so it fires after the last edge
+  timer_hw->alarm[pt_gpio_alarm] = timer_hw->timerawl + PT_GPIO_SETTLE_US ;
+}
+
+static void pt_gpio_settle_irq(void) {
+  timer_hw->intr = 1u << pt_gpio_alarm ;
+  unsigned int now = timer_hw->timerawl ;
+  uint32_t state = ~gpio_get_all() & pt_gpio_mask ;
+  uint32_t changed = state ^ pt_gpio_state ;
+  pt_gpio_state = state ;
+  while (changed) {
+    unsigned int pin = __builtin_ctz(changed) ;
+    changed &= changed - 1 ;
+    uint32_t event = (now & ~0xffu) | pin ;
+    if (state & (1u << pin)) {
+      pt_gpio_press_time[pin] = now ;
+      event |= PT_GPIO_PRESS ;
+    }
+    else {
+      event |= PT_GPIO_RELEASE ;
+    }
+    // a full queue drops the event (counted in pt_gpio_events.full)
+    pt_queue_push(&pt_gpio_events, &event, 1) ;
+  }
+}
+
+// Queue events for the pins in mask (already set up as pulled-up
+// inputs). The IRQs run on the calling core.
+static void pt_gpio_init(uint32_t mask) {
+  ringq_init(&pt_gpio_events, pt_gpio_events_buf, PT_GPIO_EVENTS, false) ;
+  pt_gpio_mask = mask ;
+  pt_gpio_state = ~gpio_get_all() & mask ;
+  pt_gpio_alarm = hardware_alarm_claim_unused(true) ;
+  irq_set_exclusive_handler(TIMER_IRQ_0 + pt_gpio_alarm, pt_gpio_settle_irq) ;
+  hw_set_bits(&timer_hw->inte, 1u << pt_gpio_alarm) ;
+  irq_set_enabled(TIMER_IRQ_0 + pt_gpio_alarm, true) ;
+  gpio_add_raw_irq_handler_masked(mask, pt_gpio_edge_irq) ;
+  for (unsigned int pin = 0; pin < 32; pin++) {
+    if (mask & (1u << pin)) {
+      gpio_set_irq_enabled(pin, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true) ;
+    }
+  }
+  irq_set_enabled(IO_IRQ_BANK0, true) ;
+}
+
+// drop the queued events, e.g. the ones left over from another screen
+static inline void pt_gpio_flush(void) {
+  uint32_t event ;
+  while (ringq_pop(&pt_gpio_events, &event, 1)) ;
+}
+
+// the next queued event on a pin in mask with one of the edges,
+// dropping the ones before it, or 0 if there is none
+static inline uint32_t pt_gpio_next(uint32_t mask, uint32_t edges) {
+  uint32_t event ;
+  while (ringq_pop(&pt_gpio_events, &event, 1)) {
+    if ((mask & (1u << PT_GPIO_PIN(event))) && (event & edges)) return event ;
+  }
+  return 0 ;
+}
+
+// true if pin has been pressed for at least hold_us
+static inline bool pt_gpio_held_for(unsigned int pin, unsigned int hold_us) {
+  return (pt_gpio_state & (1u << pin)) &&
+         timer_hw->timerawl - pt_gpio_press_time[pin] >= hold_us ;
+}
+
+// when pin will have been held for hold_us, if that is before deadline
+static inline unsigned long long pt_gpio_hold_deadline(unsigned int pin, unsigned int hold_us,
+                                                       unsigned long long deadline) {
+  if (!(pt_gpio_state & (1u << pin))) return deadline ;
+  unsigned long long now = pt_time_us() ;
+  unsigned long long at = now + (int)(pt_gpio_press_time[pin] + hold_us - (unsigned int)now) ;
+  return (at < deadline) ? at : deadline ;
+}
+
+// Park until a press (or release) on a pin in mask, and put its event
+// in event, or 0 if deadline (64-bit usec, or PT_FOREVER) came first.
+// Events queued before it on other pins are dropped.
+#define PT_WAIT_PRESS(pt, mask, deadline, event) \
+  PT_WAIT_EVENT_UNTIL(pt, pt_gpio_events.waiters, \
+    ((event) = pt_gpio_next((mask), PT_GPIO_PRESS)) != 0, deadline)
+#define PT_WAIT_RELEASE(pt, mask, deadline, event) \
+  PT_WAIT_EVENT_UNTIL(pt, pt_gpio_events.waiters, \
+    ((event) = pt_gpio_next((mask), PT_GPIO_RELEASE)) != 0, deadline)
+
+// Park until pin has been held down for hold_us, setting held, or clear
+// held if deadline came first. Looks at the debounced state, and leaves
+// the event queue alone.
+#define PT_WAIT_HOLD(pt, pin, hold_us, deadline, held) \
+  PT_WAIT_EVENT_UNTIL(pt, pt_gpio_events.waiters, \
+    ((held) = pt_gpio_held_for((pin), (hold_us))), \
+    pt_gpio_hold_deadline((pin), (hold_us), (deadline)))
+
 // see https://github.com/edartuz/c-ptx/tree/master/src
 // and the license above
-// add an entry to the thread list
-//struct ptx *pt_add( char (*pf)(struct pt *pt), int rate) {
-int pt_add( char (*pf)(struct pt *pt)) {
-  if (pt_task_count < (MAX_THREADS)) {
+// add an entry to a thread list
+static int pt_list_add(struct ptx *list, int *count, char (*pf)(struct pt *pt),
+                       char (*pfc)(struct pt *pt, void *ctx), void *ctx,
+                       unsigned int period, int priority) {
+  if (pt_wait_lock == NULL) {
+    pt_wait_lock = spin_lock_instance(spin_lock_claim_unused(true)) ;
+  }
+  if (*count < (MAX_THREADS)) {
         // get the current thread table entry 
-    struct ptx *ptx = &pt_thread_list[pt_task_count];
+    struct ptx *ptx = &list[*count];
         // enter the tak data into the thread table
-    ptx->num   = pt_task_count;
+    ptx->num   = *count;
         // function pointer
     ptx->pf    = pf;
+    ptx->pfc   = pfc;
+    ptx->ctx   = ctx;
+        // rate scheduler parameters
+    ptx->period = period;
+    ptx->priority = priority;
+    ptx->release = 0;
+    ptx->runs = ptx->overruns = 0;
+    ptx->jitter_max = ptx->jitter_sum = 0;
+    ptx->timer.queued = 0;
+    ptx->timer.fire = pt_timer_wake;
+    ptx->timer.arg = *count;
+    ptx->missed = 0;
     //
     PT_INIT( &ptx->pt );
+        // new threads are ready to run
+    pt_ready[list == pt_thread_list1] |= 1u << *count ;
         // count of number of defined threads
-    pt_task_count++;
+    (*count)++;
         // return current entry
-        return pt_task_count-1;
+        return *count-1;
   }
   return 0;
 }
 
+// add an entry to the core 0 thread list
+int pt_add( char (*pf)(struct pt *pt)) {
+  return pt_list_add(pt_thread_list, &pt_task_count, pf, NULL, NULL, 0, 0);
+}
+
 // core 1 -- add an entry to the thread list
-//struct ptx *pt_add( char (*pf)(struct pt *pt), int rate) {
 int pt_add1( char (*pf)(struct pt *pt)) {
-  if (pt_task_count1 < (MAX_THREADS)) {
-        // get the current thread table entry 
-    struct ptx *ptx = &pt_thread_list1[pt_task_count1];
-        // enter the tak data into the thread table
-    ptx->num   = pt_task_count1;
-        // function pointer
-    ptx->pf    = pf;
-    //
-    PT_INIT( &ptx->pt );
-        // count of number of defined threads
-    pt_task_count1++;
-        // return current entry
-        return pt_task_count1-1;
+  return pt_list_add(pt_thread_list1, &pt_task_count1, pf, NULL, NULL, 0, 0);
+}
+
+// for SCHED_RATE: a thread released every period usec
+// (period 0 makes a background thread, run only when nothing is due)
+int pt_add_rate( char (*pf)(struct pt *pt), unsigned int period, int priority) {
+  return pt_list_add(pt_thread_list, &pt_task_count, pf, NULL, NULL, period, priority);
+}
+
+int pt_add_rate1( char (*pf)(struct pt *pt), unsigned int period, int priority) {
+  return pt_list_add(pt_thread_list1, &pt_task_count1, pf, NULL, NULL, period, priority);
+}
+
+// reentrant thread: all of its state lives in ctx instead of in static
+// locals, so one thread function can be added several times (one per
+// player, one per game session), each with its own context. The thread
+// function is PT_THREAD (name(struct pt *pt, void *ctx)), and its locals
+// are not kept across a yield, as usual. Waits that keep state across the
+// yield take it as an argument, to point at ctx (PT_SLEEP_usec,
+// PT_QUEUE_PUSH); PT_YIELD_usec and PT_YIELD_INTERVAL keep theirs in
+// statics, shared by every instance, and are not for reentrant threads.
+int pt_add_ctx(int core, char (*pfc)(struct pt *pt, void *ctx), void *ctx,
+               unsigned int period, int priority) {
+  if (core == 1) {
+    return pt_list_add(pt_thread_list1, &pt_task_count1, NULL, pfc, ctx, period, priority);
   }
-  return 0;
+  return pt_list_add(pt_thread_list, &pt_task_count, NULL, pfc, ctx, period, priority);
 }
 
 /* Scheduler
@@ -753,6 +1496,259 @@ SOFTWARE.
 #define SCHED_RATE 1
 int pt_sched_method = SCHED_ROUND_ROBIN ;
 
+// === rate scheduler ===================================
+// Each thread is released every period usec, and each release calls the
+// thread function once, so a periodic thread does one job and PT_YIELDs.
+// Of the threads that are due, the highest priority one runs first (the
+// earliest release breaks ties). For rate-monotonic scheduling give the
+// shorter periods the higher priorities.
+// When nothing is due, the background threads (period 0) get one call
+// each. With no background threads, the core idles until the next release.
+
+// usec each core spent idle in the rate scheduler
+unsigned int pt_idle_usec[2] ;
+// when each core's scheduler started
+unsigned int pt_sched_start_usec[2] ;
+
+// === tickless idle ===================================
+// With nothing ready, a core sleeps in WFE until its next deadline (a
+// hardware alarm claimed per core), any IRQ, or a wake from the other
+// core (pt_wake does a SEV). Only the core stops: the clocks stay on, so
+// the VGA and audio DMA keep running.
+static int pt_idle_alarm[2] = {-1, -1} ;
+
+// 32-bit time tests, which hold across the wrap of the low timer word as
+// long as the two times are within 35 minutes of each other
+// time t has come at now
+static inline bool pt_due(unsigned int now, unsigned int t) {
+  return (int)(now - t) >= 0 ;
+}
+// time a comes before time b
+static inline bool pt_before(unsigned int a, unsigned int b) {
+  return (int)(a - b) < 0 ;
+}
+
+static void pt_idle_alarm_irq(void) {
+  // only here to end the WFE
+  timer_hw->intr = 1u << pt_idle_alarm[get_core_num()] ;
+}
+
+// sleep until pt_ready changes from ready, or until deadline if timed
+static void pt_idle(int core, unsigned int ready, bool timed, unsigned int deadline) {
+  unsigned int start = timer_hw->timerawl ;
+  if (timed) {
+    if (pt_idle_alarm[core] < 0) {
+      pt_idle_alarm[core] = hardware_alarm_claim_unused(true) ;
+      irq_set_exclusive_handler(TIMER_IRQ_0 + pt_idle_alarm[core], pt_idle_alarm_irq) ;
+      hw_set_bits(&timer_hw->inte, 1u << pt_idle_alarm[core]) ;
+      irq_set_enabled(TIMER_IRQ_0 + pt_idle_alarm[core], true) ;
+    }
+    // the alarm fires when the low 32 bits match, so a deadline that has
+    // already passed is caught by the loop test instead
+    timer_hw->alarm[pt_idle_alarm[core]] = deadline ;
+  }
+  while (pt_ready[core] == ready &&
+         (!timed || !pt_due(timer_hw->timerawl, deadline))) {
+    __wfe() ;
+  }
+  if (timed) {
+    timer_hw->armed = 1u << pt_idle_alarm[core] ;
+  }
+  pt_idle_usec[core] += timer_hw->timerawl - start ;
+}
+
+// percent of the time a core was idle since the previous call for that
+// core (or since its scheduler started)
+int pt_core_idle(int core) {
+  static unsigned int last_time[2], last_idle[2] ;
+  unsigned int now = timer_hw->timerawl ;
+  unsigned int idle = pt_idle_usec[core] ;
+  if (last_time[core] == 0) last_time[core] = pt_sched_start_usec[core] ;
+  unsigned int elapsed = now - last_time[core] ;
+  unsigned int idled = idle - last_idle[core] ;
+  last_time[core] = now ;
+  last_idle[core] = idle ;
+  if (elapsed == 0) return 0 ;
+  if (idled > elapsed) return 100 ;
+  return (int)(((unsigned long long)idled * 100) / elapsed) ;
+}
+
+// percent of the time a core was busy, over the same window as pt_core_idle
+#define pt_core_load(core) (100 - pt_core_idle(core))
+
+// first releases are all at scheduler start
+static void pt_rate_start(struct ptx *list, int count, int core) {
+  unsigned int now = timer_hw->timerawl ;
+  int i ;
+  pt_sched_start_usec[core] = now ;
+  for (i=0; i<count; i++) {
+    list[i].release = now ;
+  }
+}
+
+// Among the ready threads at time now: the due thread to run (highest
+// priority, then earliest release), the next release of the others, and
+// how many background threads there are. No hardware access, so the
+// timebase benchmark can feed it times either side of the wrap.
+static int pt_rate_pick(struct ptx *list, int count, unsigned int ready, unsigned int now,
+                        struct ptx **best_out, struct ptx **next_out) {
+  struct ptx *best = NULL ;
+  struct ptx *next = NULL ;
+  int background = 0 ;
+  int i ;
+
+  for (i=0; i<count; i++) {
+    struct ptx *ptx = &list[i] ;
+    if (!(ready & (1u << i))) {
+      continue ;
+    }
+    if (ptx->period == 0) {
+      background++ ;
+    }
+    else if (pt_due(now, ptx->release)) {
+      if (best == NULL || ptx->priority > best->priority ||
+          (ptx->priority == best->priority && pt_before(ptx->release, best->release))) {
+        best = ptx ;
+      }
+    }
+    else if (next == NULL || pt_before(ptx->release, next->release)) {
+      next = ptx ;
+    }
+  }
+  *best_out = best ;
+  *next_out = next ;
+  return background ;
+}
+
+// Account for a release of ptx dispatched at now, and set its next one,
+// without trying to catch up on missed ones
+static void pt_rate_release(struct ptx *ptx, unsigned int now) {
+  unsigned int jitter = now - ptx->release ;
+  ptx->runs++ ;
+  ptx->jitter_sum += jitter ;
+  if (jitter > ptx->jitter_max) ptx->jitter_max = jitter ;
+  ptx->release += ptx->period ;
+  if (pt_due(now, ptx->release)) {
+    ptx->overruns++ ;
+    ptx->release = now + ptx->period ;
+  }
+}
+
+// When an idle core should wake: the next release, or the next timer on
+// its wheel if that is sooner. Returns false for no deadline at all.
+static bool pt_idle_deadline(struct ptx *next, struct pt_wheel *wheel, unsigned int *deadline) {
+  bool timed = false ;
+  unsigned long long wake ;
+  if (next) {
+    timed = true ;
+    *deadline = next->release ;
+  }
+  if (pt_wheel_next(wheel, &wake) && (!timed || pt_before((unsigned int)wake, *deadline))) {
+    timed = true ;
+    *deadline = (unsigned int)wake ;
+  }
+  return timed ;
+}
+
+// one scheduling decision, among the threads that are not parked
+static void pt_rate_dispatch(struct ptx *list, int count, int core) {
+  struct ptx *best, *next ;
+  int background ;
+  unsigned int now, ready ;
+  int i ;
+
+  pt_sched_passes[core]++ ;
+  pt_wake_sleepers(core) ;
+  now = timer_hw->timerawl ;
+  ready = pt_ready[core] ;
+  background = pt_rate_pick(list, count, ready, now, &best, &next) ;
+
+  if (best) {
+    unsigned int bit = 1u << best->num ;
+    // releases missed while parked are not late, start again from now
+    if (pt_was_parked[core] & bit) {
+      pt_was_parked[core] &= ~bit ;
+      best->release = now ;
+    }
+    pt_rate_release(best, now) ;
+    pt_run(core, best) ;
+    pt_current[core] = -1 ;
+  }
+  else if (background) {
+    for (i=0; i<count; i++) {
+      if (list[i].period == 0 && (ready & (1u << i))) {
+        pt_run(core, &list[i]) ;
+      }
+    }
+    pt_current[core] = -1 ;
+  }
+  else {
+    // idle until the next release, the next sleeper, or a wake
+    unsigned int deadline = 0 ;
+    bool timed = pt_idle_deadline(next, &pt_wheel[core], &deadline) ;
+    pt_idle(core, ready, timed, deadline) ;
+  }
+}
+
+#ifdef PT_PROFILE
+// === profiler =========================================
+// start a new profiling window on both cores (counters being updated by
+// the other core at the same moment may keep a call's worth of data)
+void pt_profile_reset(void) {
+  int core, i ;
+  for (core=0; core<2; core++) {
+    struct ptx *list = core ? pt_thread_list1 : pt_thread_list ;
+    for (i=0; i<MAX_THREADS; i++) {
+      list[i].prof_calls = 0 ;
+      list[i].prof_total_us = 0 ;
+      list[i].prof_max_us = 0 ;
+      memset(list[i].prof_reason, 0, sizeof(list[i].prof_reason)) ;
+    }
+  }
+  pt_profile_start = timer_hw->timerawl ;
+}
+
+// one line per thread: calls, share of the window, average and worst
+// call, and how the calls ended (yield/wait/park/exit or end)
+void pt_profile_dump(void) {
+  unsigned int window = timer_hw->timerawl - pt_profile_start ;
+  int core, i ;
+  printf("profile over %u ms\n", window / 1000) ;
+  printf("c t     calls  %%cpu   avg_us   max_us   yield    wait    park    exit\n") ;
+  for (core=0; core<2; core++) {
+    struct ptx *list = core ? pt_thread_list1 : pt_thread_list ;
+    int count = core ? pt_task_count1 : pt_task_count ;
+    for (i=0; i<count; i++) {
+      struct ptx *ptx = &list[i] ;
+      unsigned int permille = window ? (unsigned int)(ptx->prof_total_us * 1000 / window) : 0 ;
+      printf("%d %d %9u %3u.%u %8u %8u %7u %7u %7u %7u\n", core, i, ptx->prof_calls,
+             permille / 10, permille % 10,
+             ptx->prof_calls ? (unsigned int)(ptx->prof_total_us / ptx->prof_calls) : 0,
+             ptx->prof_max_us, ptx->prof_reason[PT_YIELDED], ptx->prof_reason[PT_WAITING],
+             ptx->prof_reason[PT_PROF_PARKED], ptx->prof_reason[PT_EXITED] + ptx->prof_reason[PT_ENDED]) ;
+    }
+    printf("%d idle       %3d%%\n", core, pt_core_idle(core)) ;
+  }
+}
+#endif
+
+// print the per-thread release statistics for both cores
+void pt_rate_report(void) {
+  int core, i ;
+  for (core=0; core<2; core++) {
+    struct ptx *list = core ? pt_thread_list1 : pt_thread_list ;
+    int count = core ? pt_task_count1 : pt_task_count ;
+    printf("core %d: idle %u us of %u\n", core, pt_idle_usec[core],
+           timer_hw->timerawl - pt_sched_start_usec[core]) ;
+    for (i=0; i<count; i++) {
+      struct ptx *ptx = &list[i] ;
+      printf("  thread %d: period %u prio %d runs %u overruns %u jitter avg %u max %u us, missed %u\n",
+             ptx->num, ptx->period, ptx->priority, ptx->runs, ptx->overruns,
+             ptx->runs ? ptx->jitter_sum / ptx->runs : 0, ptx->jitter_max, ptx->missed) ;
+    }
+  }
+}
+
 static PT_THREAD (protothread_sched(struct pt *pt))
 {   
     PT_BEGIN(pt);
@@ -760,20 +1756,39 @@ static PT_THREAD (protothread_sched(struct pt *pt))
     
     if (pt_sched_method==SCHED_ROUND_ROBIN){
         while(1) {
-          // test stupid round-robin 
-          // on all defined threads
+          // round-robin on the threads that are not parked
+          unsigned int ready ;
           struct ptx *ptx = &pt_thread_list[0];
-          // step thru all defined threads
+          pt_sched_passes[0]++ ;
+          pt_wake_sleepers(0) ;
+          ready = pt_ready[0] ;
+          // nothing to run: sleep until a wake or the next sleeper is due
+          if (ready == 0) {
+            unsigned long long wake = 0 ;
+            bool timed = pt_wheel_next(&pt_wheel[0], &wake) ;
+            pt_idle(0, 0, timed, (unsigned int)wake) ;
+            continue ;
+          }
+          // step thru the ready threads
           // -- loop can have more than one initialization or increment/decrement, 
           // -- separated using comma operator. But it can have only one condition.
-          for (i=0; i<pt_task_count; i++, ptx++ ){
+          for (i=0; ready; i++, ptx++, ready >>= 1 ){
+              if (!(ready & 1)) continue ;
               // call thread function
-              (pt_thread_list[i].pf)(&ptx->pt); 
+              pt_run(0, ptx); 
           }
+          pt_current[0] = -1 ;
           // Never yields! 
           // NEVER exit while!
         } // END WHILE(1)
     } //end if (pt_sched_method==RR)       
+
+    if (pt_sched_method==SCHED_RATE){
+        pt_rate_start(pt_thread_list, pt_task_count, 0) ;
+        while(1) {
+          pt_rate_dispatch(pt_thread_list, pt_task_count, 0) ;
+        }
+    } // end if (pt_sched_method==SCHED_RATE)
      
     PT_END(pt);
 } // scheduler thread
@@ -788,20 +1803,39 @@ static PT_THREAD (protothread_sched1(struct pt *pt))
     
     if (pt_sched_method==SCHED_ROUND_ROBIN){
         while(1) {
-          // test stupid round-robin 
-          // on all defined threads
+          // round-robin on the threads that are not parked
+          unsigned int ready ;
           struct ptx *ptx = &pt_thread_list1[0];
-          // step thru all defined threads
+          pt_sched_passes[1]++ ;
+          pt_wake_sleepers(1) ;
+          ready = pt_ready[1] ;
+          // nothing to run: sleep until a wake or the next sleeper is due
+          if (ready == 0) {
+            unsigned long long wake = 0 ;
+            bool timed = pt_wheel_next(&pt_wheel[1], &wake) ;
+            pt_idle(1, 0, timed, (unsigned int)wake) ;
+            continue ;
+          }
+          // step thru the ready threads
           // -- loop can have more than one initialization or increment/decrement, 
           // -- separated using comma operator. But it can have only one condition.
-          for (i=0; i<pt_task_count1; i++, ptx++ ){
+          for (i=0; ready; i++, ptx++, ready >>= 1 ){
+              if (!(ready & 1)) continue ;
               // call thread function
-              (pt_thread_list1[i].pf)(&ptx->pt); 
+              pt_run(1, ptx); 
           }
+          pt_current[1] = -1 ;
           // Never yields! 
           // NEVER exit while!
         } // END WHILE(1)
     } // end if(pt_sched_method==SCHED_ROUND_ROBIN)      
+
+    if (pt_sched_method==SCHED_RATE){
+        pt_rate_start(pt_thread_list1, pt_task_count1, 1) ;
+        while(1) {
+          pt_rate_dispatch(pt_thread_list1, pt_task_count1, 1) ;
+        }
+    } // end if (pt_sched_method==SCHED_RATE)
      
     PT_END(pt);
 } // scheduler1 thread
@@ -827,78 +1861,270 @@ static PT_THREAD (protothread_sched1(struct pt *pt))
   }\
 } while(0) 
 
-// === serial input thread ================================
+// for SCHED_RATE, see pt_add_rate
+#define pt_add_thread_rate(thread_name,period,priority) do{\
+  if(get_core_num()==1){ \
+    pt_add_rate1(thread_name,period,priority);\
+  }  else {\
+    pt_add_rate(thread_name,period,priority);\
+  }\
+} while(0) 
+
+// === thread placement ================================
+// add a thread to a given core's list, from either core
+// (before that core's scheduler starts)
+#define pt_add_thread_on(core,thread_name,period,priority) do{\
+  if((core)==1){ \
+    pt_add_rate1(thread_name,period,priority);\
+  }  else {\
+    pt_add_rate(thread_name,period,priority);\
+  }\
+} while(0) 
+
+// add a reentrant thread with its context to a given core's list
+#define pt_add_thread_ctx_on(core,thread_name,ctx,period,priority) \
+  pt_add_ctx(core,thread_name,ctx,period,priority)
+
+// === core 1 startup ==================================
+// pt_launch_core1(init) starts core 1, runs init there (so that any IRQ
+// handlers it installs are serviced by core 1), waits for it to finish,
+// and leaves core 1 running its scheduler. Place core 1 threads first.
+#define PT_CORE1_READY 0xc0de0001
+static void (*pt_core1_init)(void) ;
+
+static void pt_core1_main(void) {
+  if (pt_core1_init) pt_core1_init() ;
+  multicore_fifo_push_blocking(PT_CORE1_READY) ;
+  pt_schedule_start ;
+}
+
+void pt_launch_core1(void (*init)(void)) {
+  pt_core1_init = init ;
+  multicore_reset_core1() ;
+  multicore_launch_core1(pt_core1_main) ;
+  // anything else in the FIFO is from a previous launch
+  while (multicore_fifo_pop_blocking() != PT_CORE1_READY) ;
+}
+
+// === serial I/O =========================================
+// serial_read and serial_write no longer move one character per pass:
+//  - output is copied into a ring that DMA channel PT_SERIAL_TX_CHAN
+//    drains into the UART, restarted from its completion IRQ
+//  - input is handled by the UART IRQ, which echoes, edits (backspace)
+//    and assembles lines, and queues finished lines in a second ring
+// A thread waiting on either is parked until the IRQ has made progress.
+// The UART IRQ runs on the core that made the first serial call.
+// Typed-ahead lines are kept for the next serial_read instead of being
+// flushed, up to the size of the line ring.
 // serial buffers
 #define pt_buffer_size 100
 char pt_serial_in_buffer[pt_buffer_size];
 char pt_serial_out_buffer[pt_buffer_size];
-// thread pointers
-static struct pt pt_serialin, pt_serialout ;
+// a serial_read or serial_write in progress: the spawned thread and its
+// buffer, so the threads keep no static state
+struct pt_serial_ctx {
+  struct pt pt;
+  char *buf;
+  int size;      // of buf, for reads
+  int sent, len; // progress, for writes
+};
+static struct pt_serial_ctx pt_serialin = {.buf = pt_serial_in_buffer, .size = pt_buffer_size} ;
+static struct pt_serial_ctx pt_serialout = {.buf = pt_serial_out_buffer, .size = pt_buffer_size} ;
 // uart
 #define UART_ID uart0
+#define PT_SERIAL_IRQ UART0_IRQ // must match UART_ID
 //
 #define pt_backspace 0x7f // make sure your backspace matches this!
 //
-static PT_THREAD (pt_serialin_polled(struct pt *pt)){
+// ring sizes (powers of 2), PT_SERIAL_TX_CHAN is defined with pt_dma_irq
+#define PT_SERIAL_TX_SIZE 256
+#define PT_SERIAL_RX_SIZE 512
+
+// aligned for the DMA read ring
+static uint8_t pt_serial_tx_ring[PT_SERIAL_TX_SIZE] __attribute__((aligned(PT_SERIAL_TX_SIZE))) ;
+static volatile unsigned int pt_serial_tx_head, pt_serial_tx_tail, pt_serial_tx_busy ;
+// finished lines, each followed by a 0
+static char pt_serial_rx_ring[PT_SERIAL_RX_SIZE] ;
+static volatile unsigned int pt_serial_rx_head, pt_serial_rx_tail, pt_serial_rx_lines ;
+// the line being typed
+static char pt_serial_line[pt_buffer_size] ;
+static int pt_serial_line_len ;
+static spin_lock_t * pt_serial_lock ;
+// threads parked in serial_read (serial_write parks on the DMA channel)
+volatile unsigned int pt_serial_rx_waiters ;
+// echo typed characters (turn off for machine-to-machine links)
+volatile bool pt_serial_echo = true ;
+// telemetry
+volatile unsigned int pt_serial_rx_bytes, pt_serial_rx_dropped, pt_serial_tx_bytes ;
+
+// start the TX DMA on whatever is queued, lock held
+static void pt_serial_tx_kick(void) {
+  unsigned int count = pt_serial_tx_head - pt_serial_tx_tail ;
+  if (pt_serial_tx_busy || count == 0) return ;
+  pt_serial_tx_busy = count ;
+  // the read ring wraps the address at the end of the buffer
+  dma_channel_transfer_from_buffer_now(PT_SERIAL_TX_CHAN,
+      &pt_serial_tx_ring[pt_serial_tx_tail & (PT_SERIAL_TX_SIZE - 1)], count) ;
+}
+
+// from pt_dma_irq: the queued bytes are in the UART, send the rest
+static void pt_serial_tx_done(void) {
+  uint32_t save = spin_lock_blocking(pt_serial_lock) ;
+  pt_serial_tx_tail += pt_serial_tx_busy ;
+  pt_serial_tx_busy = 0 ;
+  pt_serial_tx_kick() ;
+  spin_unlock(pt_serial_lock, save) ;
+}
+
+static inline unsigned int pt_serial_tx_space(void) {
+  return PT_SERIAL_TX_SIZE - (pt_serial_tx_head - pt_serial_tx_tail) ;
+}
+
+// queue up to count bytes for output, returns how many fit
+static unsigned int pt_serial_tx_put(const char *buf, unsigned int count) {
+  uint32_t save = spin_lock_blocking(pt_serial_lock) ;
+  unsigned int space = pt_serial_tx_space() ;
+  if (count > space) count = space ;
+  for (unsigned int i = 0; i < count; i++) {
+    pt_serial_tx_ring[(pt_serial_tx_head + i) & (PT_SERIAL_TX_SIZE - 1)] = buf[i] ;
+  }
+  pt_serial_tx_head += count ;
+  pt_serial_tx_bytes += count ;
+  pt_serial_tx_kick() ;
+  spin_unlock(pt_serial_lock, save) ;
+  return count ;
+}
+
+// a line is done: queue it with its 0, or drop it if the ring is full
+static void pt_serial_rx_finish(void) {
+  unsigned int len = pt_serial_line_len ;
+  pt_serial_line_len = 0 ;
+  uint32_t save = spin_lock_blocking(pt_serial_lock) ;
+  if (PT_SERIAL_RX_SIZE - (pt_serial_rx_head - pt_serial_rx_tail) < len + 1) {
+    pt_serial_rx_dropped++ ;
+    spin_unlock(pt_serial_lock, save) ;
+    return ;
+  }
+  for (unsigned int i = 0; i < len; i++) {
+    pt_serial_rx_ring[(pt_serial_rx_head + i) & (PT_SERIAL_RX_SIZE - 1)] = pt_serial_line[i] ;
+  }
+  pt_serial_rx_ring[(pt_serial_rx_head + len) & (PT_SERIAL_RX_SIZE - 1)] = 0 ;
+  pt_serial_rx_head += len + 1 ;
+  pt_serial_rx_lines++ ;
+  spin_unlock(pt_serial_lock, save) ;
+  pt_wake(&pt_serial_rx_waiters) ;
+}
+
+// UART IRQ: drain the RX FIFO through the line editor
+static void pt_serial_rx_irq(void) {
+  static const char bs_echo[] = {' ', pt_backspace} ;
+  static const char crlf[] = {'\r', '\n'} ;
+  while (uart_is_readable(UART_ID)) {
+    char ch = uart_getc(UART_ID) ;
+    pt_serial_rx_bytes++ ;
+    // <enter> terminates the line
+    if (ch == '\r') {
+      if (pt_serial_echo) pt_serial_tx_put(crlf, 2) ;
+      pt_serial_rx_finish() ;
+    }
+    // <backspace> wipes a character
+    else if (ch == pt_backspace) {
+      if (pt_serial_echo) {
+        pt_serial_tx_put(&ch, 1) ;
+        pt_serial_tx_put(bs_echo, 2) ;
+      }
+      if (pt_serial_line_len > 0) pt_serial_line_len-- ;
+    }
+    // must be a real character, a full line ends the read as before
+    else {
+      if (pt_serial_echo) pt_serial_tx_put(&ch, 1) ;
+      pt_serial_line[pt_serial_line_len++] = ch ;
+      if (pt_serial_line_len == pt_buffer_size - 1) pt_serial_rx_finish() ;
+    }
+  }
+}
+
+// copy the oldest finished line into buf (at most size-1 characters and
+// a 0), returns its length or -1 if there is none
+static int pt_serial_rx_get(char *buf, int size) {
+  int len = 0 ;
+  char ch ;
+  uint32_t save = spin_lock_blocking(pt_serial_lock) ;
+  if (pt_serial_rx_lines == 0) {
+    spin_unlock(pt_serial_lock, save) ;
+    return -1 ;
+  }
+  while ((ch = pt_serial_rx_ring[pt_serial_rx_tail++ & (PT_SERIAL_RX_SIZE - 1)]) != 0) {
+    if (len < size - 1) buf[len++] = ch ;
+  }
+  buf[len] = 0 ;
+  pt_serial_rx_lines-- ;
+  spin_unlock(pt_serial_lock, save) ;
+  return len ;
+}
+
+// set up the rings, the TX DMA channel and the RX IRQ, once
+static void pt_serial_init(void) {
+  if (pt_serial_lock != NULL) return ;
+  pt_serial_lock = spin_lock_instance(spin_lock_claim_unused(true)) ;
+
+  dma_channel_config c = dma_channel_get_default_config(PT_SERIAL_TX_CHAN) ;
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_8) ;
+  channel_config_set_read_increment(&c, true) ;
+  channel_config_set_write_increment(&c, false) ;
+  channel_config_set_ring(&c, false, __builtin_ctz(PT_SERIAL_TX_SIZE)) ;
+  channel_config_set_dreq(&c, uart_get_dreq(UART_ID, true)) ;
+  dma_channel_configure(PT_SERIAL_TX_CHAN, &c, &uart_get_hw(UART_ID)->dr, pt_serial_tx_ring, 0, false) ;
+  pt_dma_arm(PT_SERIAL_TX_CHAN) ;
+
+  // any characters typed before the first read are stale
+  while (uart_is_readable(UART_ID)) uart_getc(UART_ID) ;
+  irq_set_exclusive_handler(PT_SERIAL_IRQ, pt_serial_rx_irq) ;
+  irq_set_enabled(PT_SERIAL_IRQ, true) ;
+  // RX FIFO level and RX timeout
+  uart_set_irq_enables(UART_ID, true, false) ;
+}
+
+// hand the UART back to stdio: stop the RX IRQ and the TX DMA, empty the
+// rings and release the lock, so a later pt_serial_init starts clean
+static void pt_serial_deinit(void) {
+  if (pt_serial_lock == NULL) return ;
+  uart_set_irq_enables(UART_ID, false, false) ;
+  irq_set_enabled(PT_SERIAL_IRQ, false) ;
+  irq_remove_handler(PT_SERIAL_IRQ, pt_serial_rx_irq) ;
+  dma_channel_set_irq1_enabled(PT_SERIAL_TX_CHAN, false) ;
+  dma_channel_abort(PT_SERIAL_TX_CHAN) ;
+  pt_serial_tx_head = pt_serial_tx_tail = pt_serial_tx_busy = 0 ;
+  pt_serial_rx_head = pt_serial_rx_tail = pt_serial_rx_lines = 0 ;
+  pt_serial_line_len = 0 ;
+  spin_lock_unclaim(spin_lock_get_num(pt_serial_lock)) ;
+  pt_serial_lock = NULL ;
+}
+
+// ================================================================
+// === serial input thread: wait for a line from the UART IRQ
+static PT_THREAD (pt_serialin_irq(struct pt *pt, struct pt_serial_ctx *ctx)){
     PT_BEGIN(pt);
-      static uint8_t ch ;
-      static int pt_current_char_count ;
-      // clear the string
-      memset(pt_serial_in_buffer, 0, pt_buffer_size);
-      pt_current_char_count = 0 ;
-      // clear uart fifo
-      while(uart_is_readable(UART_ID)){uart_getc(UART_ID);}
-      // build the output string
-      while(pt_current_char_count < pt_buffer_size) {   
-        PT_YIELD_UNTIL(pt, (int)uart_is_readable(UART_ID)) ;
-        //get the character and echo it back to terminal
-        // NOTE this assumes a human is typing!!
-        ch = uart_getc(UART_ID);
-        PT_YIELD_UNTIL(pt, (int)uart_is_writable(UART_ID)) ;
-        uart_putc(UART_ID, ch);
-        // check for <enter> or <backspace>
-        if (ch == '\r' ){
-          // <enter>> character terminates string,
-          // advances the cursor to the next line, then exits
-          pt_serial_in_buffer[pt_current_char_count] = 0 ;
-          PT_YIELD_UNTIL(pt, (int)uart_is_writable(UART_ID)) ;
-          uart_putc(UART_ID, '\n') ;
-          break ; 
-        }
-        // check fo ,backspace>
-        else if (ch == pt_backspace){
-          PT_YIELD_UNTIL(pt, (int)uart_is_writable(UART_ID)) ;
-          uart_putc(UART_ID, ' ') ;
-          PT_YIELD_UNTIL(pt, (int)uart_is_writable(UART_ID)) ;
-          uart_putc(UART_ID, pt_backspace) ;
-          //uart_putc(UART_ID, ' ') ;
-          // wipe a character from the output
-          pt_current_char_count-- ;
-          if (pt_current_char_count<0) {pt_current_char_count = 0 ;}
-        }
-        // must be a real character
-        else {
-          // build the output string
-          pt_serial_in_buffer[pt_current_char_count++] = ch ;
-        }
-      } // END WHILe
+      pt_serial_init() ;
+      PT_WAIT_EVENT(pt, pt_serial_rx_waiters, pt_serial_rx_lines > 0) ;
+      pt_serial_rx_get(ctx->buf, ctx->size) ;
       // kill this input thread, to allow spawning thread to execute
     PT_EXIT(pt);
   PT_END(pt);
 } // serial input thread
 
 // ================================================================
-// === serial output thread
-//
-int pt_serialout_polled(struct pt *pt)
+// === serial output thread: copy the string into the TX ring, parking
+// on the DMA channel while the ring is full
+int pt_serialout_dma(struct pt *pt, struct pt_serial_ctx *ctx)
 {
-    static int num_send_chars ;
     PT_BEGIN(pt);
-    num_send_chars = 0;
-    while (pt_serial_out_buffer[num_send_chars] != 0){
-        PT_YIELD_UNTIL(pt, (int)uart_is_writable(UART_ID)) ;
-        uart_putc(UART_ID, pt_serial_out_buffer[num_send_chars]) ;
-        num_send_chars++;
+    pt_serial_init() ;
+    ctx->sent = 0;
+    ctx->len = strlen(ctx->buf) ;
+    while (ctx->sent < ctx->len){
+        PT_WAIT_EVENT(pt, pt_dma_waiters[PT_SERIAL_TX_CHAN], pt_serial_tx_space() > 0) ;
+        ctx->sent += pt_serial_tx_put(ctx->buf + ctx->sent, ctx->len - ctx->sent) ;
     }
     // kill this output thread, to allow spawning thread to execute
     PT_EXIT(pt);
@@ -907,8 +2133,11 @@ int pt_serialout_polled(struct pt *pt)
 }
 // ================================================================
 // package the spawn read/write macros to make them look better
-#define serial_write do{PT_SPAWN(pt,&pt_serialout,pt_serialout_polled(&pt_serialout));}while(0)
-#define serial_read  do{PT_SPAWN(pt,&pt_serialin,pt_serialin_polled(&pt_serialin));}while(0)
+#define serial_write do{PT_SPAWN(pt,&pt_serialout.pt,pt_serialout_dma(&pt_serialout.pt,&pt_serialout));}while(0)
+#define serial_read  do{PT_SPAWN(pt,&pt_serialin.pt,pt_serialin_irq(&pt_serialin.pt,&pt_serialin));}while(0)
+// the same with a caller's own pt_serial_ctx and buffer, for reentrant threads
+#define serial_write_ctx(c) do{PT_SPAWN(pt,&(c)->pt,pt_serialout_dma(&(c)->pt,(c)));}while(0)
+#define serial_read_ctx(c)  do{PT_SPAWN(pt,&(c)->pt,pt_serialin_irq(&(c)->pt,(c)));}while(0)
 //
 // ======
 // END
@@ -0,0 +1,61 @@
+/**
+ * Ring buffer queues, see ringq.h
+ */
+
+#include "pico/stdlib.h"
+#include "ringq.h"
+
+void ringq_init(ringq_t * q, uint32_t * buf, unsigned int capacity, bool multi_producer) {
+  while (capacity & (capacity - 1)) {
+    capacity &= capacity - 1 ;
+  }
+  q->buf = buf ;
+  q->mask = capacity - 1 ;
+  q->head = 0 ;
+  q->tail = 0 ;
+  q->waiters = 0 ;
+  q->full = 0 ;
+  q->lock = multi_producer ? spin_lock_instance(spin_lock_claim_unused(true)) : NULL ;
+}
+
+unsigned int ringq_push(ringq_t * q, const uint32_t * items, unsigned int n) {
+  uint32_t irq_state = 0 ;
+  if (q->lock) {
+    irq_state = spin_lock_blocking(q->lock) ;
+  }
+
+  uint32_t head = q->head ;
+  uint32_t space = q->mask + 1 - (head - q->tail) ;
+  if (n > space) {
+    n = space ;
+    q->full++ ;
+  }
+  for (unsigned int i = 0; i < n; i++) {
+    q->buf[(head + i) & q->mask] = items[i] ;
+  }
+  // the words must land before the consumer can see the new head
+  __dmb() ;
+  q->head = head + n ;
+
+  if (q->lock) {
+    spin_unlock(q->lock, irq_state) ;
+  }
+  return n ;
+}
+
+unsigned int ringq_pop(ringq_t * q, uint32_t * items, unsigned int max) {
+  uint32_t tail = q->tail ;
+  uint32_t count = q->head - tail ;
+  // don't read words from before the head was published
+  __dmb() ;
+  if (max > count) {
+    max = count ;
+  }
+  for (unsigned int i = 0; i < max; i++) {
+    items[i] = q->buf[(tail + i) & q->mask] ;
+  }
+  // finish reading before the producer can reuse the slots
+  __dmb() ;
+  q->tail = tail + max ;
+  return max ;
+}
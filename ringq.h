@@ -0,0 +1,51 @@
+/**
+ * Ring buffer queues of 32-bit words, for passing data between cores
+ *
+ * The queue lives in shared SRAM, so it can hold far more than the 8-word
+ * SIO FIFO, and it moves whole batches per call. Head and tail are
+ * free-running and each is written by one side only, so a single producer
+ * and a single consumer never lock. The M0+ has no atomic
+ * read-modify-write, so on a multi-producer queue the producers take a
+ * claimed hardware spinlock while they copy in; the consumer still
+ * never locks.
+ *
+ * Pass pointers to move anything bigger than a word (draw commands,
+ * audio blocks). For protothreads that wait on a queue, see the
+ * PT_QUEUE macros in pt_cornell_rp2040_v1.h.
+ */
+
+#ifndef RINGQ_H
+#define RINGQ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/sync.h"
+
+typedef struct {
+  uint32_t * buf ;
+  uint32_t mask ;                  // capacity - 1
+  volatile uint32_t head ;         // words pushed, written by the producer(s)
+  volatile uint32_t tail ;         // words popped, written by the consumer
+  spin_lock_t * lock ;             // multi-producer queues only
+  volatile unsigned int waiters ;  // protothreads parked on the queue
+  uint32_t full ;                  // pushes that did not completely fit
+} ringq_t ;
+
+// capacity (words in buf) is rounded down to a power of 2. Call once per
+// queue: a multi-producer queue claims a spinlock.
+void ringq_init(ringq_t * q, uint32_t * buf, unsigned int capacity, bool multi_producer) ;
+
+// Push up to n words, returns how many fit
+unsigned int ringq_push(ringq_t * q, const uint32_t * items, unsigned int n) ;
+// Pop up to max words, returns how many there were
+unsigned int ringq_pop(ringq_t * q, uint32_t * items, unsigned int max) ;
+
+static inline unsigned int ringq_count(const ringq_t * q) {
+  return q->head - q->tail ;
+}
+
+static inline unsigned int ringq_space(const ringq_t * q) {
+  return q->mask + 1 - (q->head - q->tail) ;
+}
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * Small seedable random numbers
+ *
+ * xorshift32 with its state in an rng_t, so every user has its own
+ * stream, no locking, and no division. Bounded draws reject the values
+ * past the smallest power of 2 that covers the range, so they are
+ * unbiased and cost a mask and a compare (and on average fewer than two
+ * draws). rng_seed scrambles the seed through a hash, so nearby seeds
+ * (a seed plus an index, say) give unrelated streams.
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+#include "hardware/structs/rosc.h"
+
+typedef struct {
+  uint32_t state ;  // never 0
+} rng_t ;
+
+// 32-bit integer hash (lowbias32), a bijection
+static inline uint32_t rng_mix(uint32_t x) {
+  x ^= x >> 16 ;
+  x *= 0x7feb352d ;
+  x ^= x >> 15 ;
+  x *= 0x846ca68b ;
+  x ^= x >> 16 ;
+  return x ;
+}
+
+static inline void rng_seed(rng_t * r, uint32_t seed) {
+  r->state = rng_mix(seed) ;
+  // the one state xorshift can't leave
+  if (r->state == 0) {
+    r->state = 0x6d2b79f5 ;
+  }
+}
+
+static inline uint32_t rng_next(rng_t * r) {
+  uint32_t x = r->state ;
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  r->state = x ;
+  return x ;
+}
+
+// Uniform in [0, n), n > 0
+static inline uint32_t rng_below(rng_t * r, uint32_t n) {
+  uint32_t mask = 0xffffffffu >> __builtin_clz((n - 1) | 1) ;
+  uint32_t x ;
+  do {
+    x = rng_next(r) & mask ;
+  } while (x >= n) ;
+  return x ;
+}
+
+// A seed from the jitter of the ring oscillator, different every boot
+static inline uint32_t rng_rosc_seed(void) {
+  uint32_t x = 0 ;
+  for (int i = 0; i < 64; i++) {
+    x = (x << 1) ^ (x >> 31) ^ rosc_hw->randombit ;
+  }
+  return rng_mix(x) ;
+}
+
+#endif
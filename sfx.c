@@ -0,0 +1,240 @@
+/**
+ * Sound effects, see sfx.h
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "audio.h"
+#include "sfx.h"
+
+#define WAVE_SQUARE   0
+#define WAVE_TRIANGLE 1
+
+// How each effect is synthesized: a linear frequency sweep from f0 to f1
+// with a linearly decaying envelope. gain scales the 8-bit samples into
+// the 12-bit DAC range (16 = full scale).
+typedef struct {
+  uint16_t f0, f1 ;    // Hz
+  uint16_t ms ;        // duration
+  uint8_t amp ;        // peak amplitude, out of 127
+  uint8_t wave ;
+  uint8_t gain ;
+  uint8_t priority ;   // higher can steal from lower
+} sfx_recipe_t ;
+
+static const sfx_recipe_t recipes[SFX_COUNT] = {
+  [SFX_MENU_MOVE]    = {1200, 1200,  40, 100, WAVE_SQUARE,   6, 1},
+  [SFX_MENU_SELECT]  = { 800, 1600,  90, 100, WAVE_SQUARE,   6, 2},
+  [SFX_BARRIER_PASS] = { 880, 1760, 120, 120, WAVE_TRIANGLE, 8, 2},
+  [SFX_PLAYER_MOVE]  = { 200,  120,  12,  80, WAVE_TRIANGLE, 4, 0},
+} ;
+
+// The effect table: where each effect sits in the pool
+typedef struct {
+  uint16_t offset ;
+  uint16_t length ;
+  uint8_t gain ;
+  uint8_t priority ;
+} sfx_def_t ;
+
+static int8_t sfx_pool[SFX_POOL_BYTES] ;
+static sfx_def_t sfx_table[SFX_COUNT] ;
+
+typedef struct {
+  const int8_t * next ;   // next sample to mix
+  uint16_t remaining ;    // 0 when the voice is free
+  uint8_t id ;
+  uint8_t gain ;
+  uint8_t priority ;
+  bool started ;          // first sample has been mixed
+  uint32_t trigger_us ;   // when sfx_play was called
+} voice_t ;
+
+// Only touched with the audio lock held
+static voice_t voices[SFX_VOICES] ;
+static sfx_stats_t stats ;
+// Voices new effects may take, see sfx_set_voices
+static unsigned int voices_in_use = SFX_VOICES ;
+
+// Synthesize one effect into dst, returns its length
+static unsigned int synth(int8_t * dst, const sfx_recipe_t * r, unsigned int rate, unsigned int room) {
+  if (rate == 0) {
+    return 0 ;
+  }
+  unsigned int len = (r->ms * rate) / 1000 ;
+  if (len > room) {
+    len = room ;
+  }
+  if (len > 0xffff) {
+    len = 0xffff ;
+  }
+
+  uint32_t phase = 0 ;
+  for (unsigned int i = 0; i < len; i++) {
+    int f = r->f0 + ((r->f1 - r->f0) * (int)i) / (int)len ;
+    phase += (uint32_t)(((uint64_t)f << 32) / rate) ;
+
+    int v ;
+    if (r->wave == WAVE_SQUARE) {
+      v = (phase & 0x80000000u) ? 127 : -127 ;
+    }
+    else {
+      int p = phase >> 24 ;
+      v = (p < 128) ? (p * 2 - 127) : ((255 - p) * 2 - 127) ;
+    }
+    // Linear decay
+    dst[i] = (int8_t)((v * (int)r->amp * (int)(len - i)) / (127 * (int)len)) ;
+  }
+  return len ;
+}
+
+// Add as much of voice v as fits into samples
+static void mix_voice(voice_t * v, uint16_t * samples, unsigned int count, unsigned int delay_us) {
+  unsigned int n = (count < v->remaining) ? count : v->remaining ;
+  if (n == 0) {
+    return ;
+  }
+
+  if (!v->started) {
+    uint32_t latency = (time_us_32() - v->trigger_us) + delay_us ;
+    stats.latency_last_us = latency ;
+    if (latency > stats.latency_max_us) {
+      stats.latency_max_us = latency ;
+    }
+    v->started = true ;
+  }
+
+  const int8_t * src = v->next ;
+  int gain = v->gain ;
+  for (unsigned int i = 0; i < n; i++) {
+    int s = (samples[i] & 0x0fff) + src[i] * gain ;
+    if (s < 0) s = 0 ;
+    if (s > 0x0fff) s = 0x0fff ;
+    samples[i] = (samples[i] & 0xf000) | s ;
+  }
+  v->next += n ;
+  v->remaining -= n ;
+}
+
+// Audio mixer, called from the end-of-block IRQ
+static void mix_voices(uint16_t * samples, unsigned int count, unsigned int delay_us) {
+  for (int i = 0; i < SFX_VOICES; i++) {
+    if (voices[i].remaining) {
+      mix_voice(&voices[i], samples, count, delay_us) ;
+    }
+  }
+}
+
+// Choose a voice for effect id, or NULL to drop it
+static voice_t * pick_voice(enum sfx_id id) {
+  const sfx_def_t * def = &sfx_table[id] ;
+  voice_t * victim = NULL ;
+
+  // Retrigger the same effect rather than layering it
+  for (unsigned int i = 0; i < voices_in_use; i++) {
+    if (voices[i].remaining && voices[i].id == id) {
+      return &voices[i] ;
+    }
+  }
+  for (unsigned int i = 0; i < voices_in_use; i++) {
+    if (voices[i].remaining == 0) {
+      return &voices[i] ;
+    }
+  }
+
+  // All busy: lowest priority first, then whichever is closest to done
+  for (unsigned int i = 0; i < voices_in_use; i++) {
+    voice_t * v = &voices[i] ;
+    if (v->priority > def->priority) {
+      continue ;
+    }
+    if (victim == NULL || v->priority < victim->priority ||
+        (v->priority == victim->priority && v->remaining < victim->remaining)) {
+      victim = v ;
+    }
+  }
+  if (victim) {
+    stats.steals++ ;
+  }
+  return victim ;
+}
+
+// Runs with the audio lock held. samples is the part of the next block
+// that has already been mixed, so the new voice catches up with it.
+static void start_voice(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg) {
+  enum sfx_id id = (enum sfx_id)(uintptr_t) arg ;
+  const sfx_def_t * def = &sfx_table[id] ;
+
+  stats.triggers++ ;
+  voice_t * v = pick_voice(id) ;
+  if (v == NULL) {
+    stats.drops++ ;
+    return ;
+  }
+
+  v->next = &sfx_pool[def->offset] ;
+  v->remaining = def->length ;
+  v->id = id ;
+  v->gain = def->gain ;
+  v->priority = def->priority ;
+  v->started = false ;
+  v->trigger_us = time_us_32() ;
+  mix_voice(v, samples, count, delay_us) ;
+}
+
+static void clear_voices(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg) {
+  for (int i = 0; i < SFX_VOICES; i++) {
+    voices[i].remaining = 0 ;
+  }
+}
+
+static void set_voices(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg) {
+  voices_in_use = (unsigned int)(uintptr_t) arg ;
+}
+
+static void copy_stats(uint16_t * samples, unsigned int count, unsigned int delay_us, void * arg) {
+  if (arg) {
+    *(sfx_stats_t *) arg = stats ;
+  }
+  else {
+    memset(&stats, 0, sizeof(stats)) ;
+  }
+}
+
+void sfx_init() {
+  unsigned int rate = audio_rate_hz() ;
+  unsigned int used = 0 ;
+  for (int i = 0; i < SFX_COUNT; i++) {
+    sfx_table[i].offset = used ;
+    sfx_table[i].length = synth(&sfx_pool[used], &recipes[i], rate, SFX_POOL_BYTES - used) ;
+    sfx_table[i].gain = recipes[i].gain ;
+    sfx_table[i].priority = recipes[i].priority ;
+    used += sfx_table[i].length ;
+  }
+  audio_set_mixer(mix_voices) ;
+}
+
+void sfx_play(enum sfx_id id) {
+  if (id >= SFX_COUNT) {
+    return ;
+  }
+  audio_with_next_block(start_voice, (void *)(uintptr_t) id) ;
+}
+
+void sfx_stop_all() {
+  audio_with_next_block(clear_voices, NULL) ;
+}
+
+void sfx_set_voices(unsigned int n) {
+  if (n < 1) n = 1 ;
+  if (n > SFX_VOICES) n = SFX_VOICES ;
+  audio_with_next_block(set_voices, (void *)(uintptr_t) n) ;
+}
+
+void sfx_get_stats(sfx_stats_t * s) {
+  audio_with_next_block(copy_stats, s) ;
+}
+
+void sfx_reset_stats() {
+  audio_with_next_block(copy_stats, NULL) ;
+}
@@ -0,0 +1,54 @@
+/**
+ * Sound effects mixed on top of the audio ring (see audio.h)
+ *
+ * Effects are synthesized into a RAM pool at startup as signed 8-bit
+ * samples, and played by a small set of voices. The audio IRQ mixes the
+ * voices into each block just before it plays, and sfx_play also mixes a
+ * new voice into the block that starts next, so an effect is heard
+ * within one audio block of the call.
+ *
+ * When every voice is busy, a new effect takes over the voice already
+ * playing the same effect, or else steals the lowest priority voice that
+ * is closest to finishing. Effects of lower priority than everything
+ * playing are dropped.
+ *
+ * Voices are only touched with the audio lock held, so sfx_play is safe
+ * to call from any protothread on either core.
+ */
+
+#ifndef SFX_H
+#define SFX_H
+
+#include <stdint.h>
+
+// Effects in the table
+enum sfx_id {SFX_MENU_MOVE, SFX_MENU_SELECT, SFX_BARRIER_PASS, SFX_PLAYER_MOVE, SFX_COUNT} ;
+
+// Number of effects that can sound at once
+#define SFX_VOICES 4
+// Bytes of RAM holding the synthesized effects
+#define SFX_POOL_BYTES 6144
+
+typedef struct {
+  uint32_t triggers ;         // calls to sfx_play
+  uint32_t steals ;           // effects that took over a busy voice
+  uint32_t drops ;            // effects dropped for lack of a voice
+  uint32_t latency_last_us ;  // sfx_play call to first sample at the DAC
+  uint32_t latency_max_us ;
+} sfx_stats_t ;
+
+// Synthesize the effect table and install the mixer. Call after audio_init.
+void sfx_init(void) ;
+// Start an effect
+void sfx_play(enum sfx_id id) ;
+// Silence every voice
+void sfx_stop_all(void) ;
+// Play new effects on only the first n voices (1..SFX_VOICES), so there
+// are fewer voices than effects. For the benchmarks, to exercise voice
+// stealing.
+void sfx_set_voices(unsigned int n) ;
+
+void sfx_get_stats(sfx_stats_t * stats) ;
+void sfx_reset_stats(void) ;
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * Parallax starfield, see starfield.h
+ */
+
+#include "pico/stdlib.h"
+#include "vga_graphics.h"
+#include "starfield.h"
+
+// Stars updated between checks of the clock
+#define STARFIELD_CHECK_EVERY 32
+
+// Color of each layer, far to near
+static const char layer_color[STARFIELD_LAYERS] = {BLUE, BLUE, MAGENTA} ;
+
+void starfield_init(starfield_t * s, unsigned int count, uint32_t seed) {
+  rng_t rng ;
+  rng_seed(&rng, seed) ;
+  if (count > STARFIELD_MAX) {
+    count = STARFIELD_MAX ;
+  }
+  s->count = count ;
+  for (unsigned int i = 0; i < count; i++) {
+    s->home_x[i] = rng_below(&rng, 640) ;
+    s->y[i] = rng_below(&rng, 480) ;
+    // Half the stars on the far layer, a quarter on each of the others
+    uint32_t r = rng_below(&rng, 4) ;
+    s->layer[i] = (r < 2) ? 0 : r - 1 ;
+  }
+  s->cursor = 0 ;
+  s->capped = 0 ;
+  starfield_clear(s) ;
+}
+
+void starfield_clear(starfield_t * s) {
+  for (unsigned int i = 0; i < s->count; i++) {
+    s->drawn_x[i] = -1 ;
+  }
+}
+
+unsigned int starfield_update(starfield_t * s, fix15 scroll, unsigned int cap_us) {
+  // How far each layer has moved, within a screen width
+  int shift[STARFIELD_LAYERS] ;
+  for (int l = 0; l < STARFIELD_LAYERS; l++) {
+    shift[l] = fix2int15(scroll >> (STARFIELD_LAYERS - l)) % 640 ;
+  }
+
+  unsigned int start = time_us_32() ;
+  unsigned int i = s->cursor ;
+  unsigned int done = 0 ;
+  while (done < s->count) {
+    if (done % STARFIELD_CHECK_EVERY == 0 && done && time_us_32() - start >= cap_us) {
+      s->capped++ ;
+      break ;
+    }
+    unsigned int l = s->layer[i] ;
+    char color = layer_color[l] ;
+    short y = s->y[i] ;
+    short x = s->home_x[i] - shift[l] ;
+    if (x < 0) x += 640 ;
+    short old = s->drawn_x[i] ;
+
+    // Leave pixels something else has drawn over alone
+    if (old >= 0 && old != x && readPixel(old, y) == color) {
+      drawPixelFast(old, y, BLACK) ;
+    }
+    char under = readPixel(x, y) ;
+    if (under == BLACK) {
+      drawPixelFast(x, y, color) ;
+      s->drawn_x[i] = x ;
+    }
+    else {
+      s->drawn_x[i] = (under == color) ? x : -1 ;
+    }
+
+    if (++i == s->count) i = 0 ;
+    done++ ;
+  }
+  s->cursor = i ;
+  return done ;
+}
@@ -0,0 +1,61 @@
+/**
+ * Parallax starfield behind the playfield
+ *
+ * Stars are single pixels on STARFIELD_LAYERS layers, each scrolling
+ * left at half the speed of the one in front of it, the nearest at half
+ * the barrier speed. A star's position is a function of the scroll, so
+ * an update only touches the stars that moved a pixel: it erases the
+ * old pixel and plots the new one, and the screen is never cleared.
+ *
+ * Stars sit under everything else by layer priority: a star is plotted
+ * only on black, and its old pixel is erased only if it still has the
+ * star's color, so barriers, players and text are never drawn over or
+ * punched through. Star colors are ones the playfield doesn't use.
+ *
+ * starfield_update stops once it has run for its cap, and the next
+ * update starts from the first star it didn't reach, so a slow frame
+ * leaves some stars a frame behind instead of running late.
+ */
+
+#ifndef STARFIELD_H
+#define STARFIELD_H
+
+#include <stdint.h>
+#include "fix15.h"
+#include "rng.h"
+
+// Capacity of a starfield
+#ifndef STARFIELD_MAX
+#define STARFIELD_MAX 512
+#endif
+
+#define STARFIELD_LAYERS 3
+
+// The scroll wraps here, where every layer has moved a whole number of
+// screen widths
+#define STARFIELD_WRAP int2fix15(640 << STARFIELD_LAYERS)
+
+typedef struct {
+  unsigned int count ;
+  int16_t home_x[STARFIELD_MAX] ;     // x at scroll 0
+  int16_t y[STARFIELD_MAX] ;
+  int16_t drawn_x[STARFIELD_MAX] ;    // where it is on screen, or -1
+  uint8_t layer[STARFIELD_MAX] ;      // 0 is the farthest
+  // Next star to update
+  unsigned int cursor ;
+  // Updates that stopped at the cap
+  unsigned int capped ;
+} starfield_t ;
+
+// count stars (up to STARFIELD_MAX) at random spots
+void starfield_init(starfield_t * s, unsigned int count, uint32_t seed) ;
+
+// Forget what is on screen, after it has been cleared
+void starfield_clear(starfield_t * s) ;
+
+// Move the stars to scroll (fix15 pixels of barrier travel, below
+// STARFIELD_WRAP), spending at most cap_us. Returns how many stars were
+// updated.
+unsigned int starfield_update(starfield_t * s, fix15 scroll, unsigned int cap_us) ;
+
+#endif
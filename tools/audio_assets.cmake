@@ -0,0 +1,31 @@
+# Build stage that turns WAV/raw recordings into flash-resident DAC blobs.
+#
+#   add_audio_asset(<target> <symbol name> <source file>)
+#
+# generates <symbol name>.bin/.S/.h in ${CMAKE_CURRENT_BINARY_DIR}/assets,
+# links the blob into <target> with .incbin and puts the generated header
+# (sample count, rate and format metadata) on the include path.
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(AUDIO_ASSET_TOOL ${CMAKE_CURRENT_LIST_DIR}/wav2dac.py)
+
+function(add_audio_asset TARGET NAME SOURCE)
+    set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/assets)
+    get_filename_component(source_path ${SOURCE} ABSOLUTE)
+
+    add_custom_command(
+        OUTPUT ${out_dir}/${NAME}.bin ${out_dir}/${NAME}.S ${out_dir}/${NAME}.h
+        COMMAND ${Python3_EXECUTABLE} ${AUDIO_ASSET_TOOL}
+                --name ${NAME} --out-dir ${out_dir} ${source_path}
+        DEPENDS ${source_path} ${AUDIO_ASSET_TOOL}
+        COMMENT "Converting audio asset ${NAME}"
+        VERBATIM)
+
+    # The .S only references the .bin through .incbin, so spell out the dependency
+    set_source_files_properties(${out_dir}/${NAME}.S PROPERTIES
+        OBJECT_DEPENDS ${out_dir}/${NAME}.bin)
+
+    target_sources(${TARGET} PRIVATE ${out_dir}/${NAME}.S ${out_dir}/${NAME}.h)
+    target_include_directories(${TARGET} PRIVATE ${out_dir})
+endfunction()
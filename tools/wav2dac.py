@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Convert a WAV (or headerless 8-bit unsigned .raw) audio file into a binary
+blob of MCP4822 DAC words, plus the assembly stub that links it into flash
+with .incbin and a header describing its size and format.
+
+Each output sample is a little-endian 16-bit word:
+    dac_config | (sample_12bit & 0x0fff)
+which is exactly what the audio DMA channel writes to the SPI data register.
+
+Usage:
+    wav2dac.py --name audio_cropped_8bit --out-dir build/assets song.wav
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+
+def read_samples(path, raw_rate):
+    """Return (rate_hz, source_bits, [12-bit unsigned samples])."""
+    if path.lower().endswith(".raw"):
+        with open(path, "rb") as f:
+            data = f.read()
+        return raw_rate, 8, [b << 4 for b in data]
+
+    with wave.open(path, "rb") as w:
+        if w.getcomptype() != "NONE":
+            sys.exit("%s: only uncompressed PCM is supported" % path)
+        channels = w.getnchannels()
+        width = w.getsampwidth()
+        rate = w.getframerate()
+        frames = w.readframes(w.getnframes())
+
+    if width == 1:
+        # 8-bit WAV is unsigned
+        values = list(frames)
+        to12 = lambda v: v << 4
+    elif width == 2:
+        # 16-bit WAV is signed little-endian
+        values = list(struct.unpack("<%dh" % (len(frames) // 2), frames))
+        to12 = lambda v: (v + 32768) >> 4
+    else:
+        sys.exit("%s: unsupported sample width %d" % (path, width))
+
+    # Mix down to mono by averaging channels
+    if channels > 1:
+        values = [sum(values[i:i + channels]) // channels
+                  for i in range(0, len(values), channels)]
+
+    return rate, width * 8, [to12(v) for v in values]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__,
+                                 formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("source", help="input .wav or .raw file")
+    ap.add_argument("--name", required=True, help="C symbol name for the blob")
+    ap.add_argument("--out-dir", required=True, help="directory for generated files")
+    ap.add_argument("--dac-config", default="0x3000",
+                    help="DAC command bits OR'd into every word (default: A-channel, 1x, active)")
+    ap.add_argument("--raw-rate", type=int, default=15259,
+                    help="sample rate recorded for headerless .raw input")
+    args = ap.parse_args()
+
+    rate, bits, samples = read_samples(args.source, args.raw_rate)
+    if not samples:
+        sys.exit("%s: no samples" % args.source)
+    config = int(args.dac_config, 0) & 0xf000
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    bin_path = os.path.join(args.out_dir, args.name + ".bin")
+    asm_path = os.path.join(args.out_dir, args.name + ".S")
+    hdr_path = os.path.join(args.out_dir, args.name + ".h")
+
+    with open(bin_path, "wb") as f:
+        f.write(struct.pack("<%dH" % len(samples),
+                            *[config | (s & 0x0fff) for s in samples]))
+
+    # Blobs are word aligned so the XIP streaming interface can read them
+    with open(asm_path, "w") as f:
+        f.write("// Generated by wav2dac.py from %s -- do not edit\n"
+                % os.path.basename(args.source))
+        f.write("    .section .rodata.%s, \"a\"\n" % args.name)
+        f.write("    .balign 4\n")
+        f.write("    .global %s\n" % args.name)
+        f.write("    .type %s, %%object\n" % args.name)
+        f.write("%s:\n" % args.name)
+        f.write("    .incbin \"%s\"\n" % os.path.abspath(bin_path).replace("\\", "/"))
+        f.write("    .size %s, . - %s\n" % (args.name, args.name))
+
+    macro = args.name.upper()
+    with open(hdr_path, "w") as f:
+        f.write("// Generated by wav2dac.py from %s -- do not edit\n"
+                % os.path.basename(args.source))
+        f.write("#ifndef %s_H\n#define %s_H\n\n" % (macro, macro))
+        f.write("#include <stdint.h>\n\n")
+        f.write("// Number of 16-bit DAC words in the blob\n")
+        f.write("#define %s_SAMPLES     %du\n" % (macro, len(samples)))
+        f.write("// Sample rate and bit depth of the source recording\n")
+        f.write("#define %s_RATE_HZ     %du\n" % (macro, rate))
+        f.write("#define %s_SOURCE_BITS %d\n" % (macro, bits))
+        f.write("// Command bits in the top nibble of every word\n")
+        f.write("#define %s_DAC_CONFIG  0x%04xu\n\n" % (macro, config))
+        f.write("extern const uint16_t %s[%s_SAMPLES];\n\n" % (args.name, macro))
+        f.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -188,6 +188,56 @@ void drawHLine(short x, short y, short w, char color) {
     }
 }
 
+// drawPixel without the range checks, for callers that clip for
+// themselves (x in 0..639, y in 0..479)
+void drawPixelFast(short x, short y, char color) {
+    int pixel = ((640 * y) + x) ;
+    if (pixel & 1) {
+        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & TOPMASK) | (color << 3) ;
+    }
+    else {
+        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & BOTTOMMASK) | (color) ;
+    }
+}
+
+// Color of the pixel at x, y, with no range checks
+char readPixel(short x, short y) {
+    int pixel = ((640 * y) + x) ;
+    if (pixel & 1) {
+        return (vga_data_array[pixel>>1] >> 3) & 7 ;
+    }
+    return vga_data_array[pixel>>1] & 7 ;
+}
+
+// A horizontal run of w pixels, clipped to the screen. Each byte holds
+// two pixels, so the middle of the run is whole-byte stores, with a
+// read-modify-write only for an odd pixel at either end.
+void drawSpan(short x, short y, short w, char color) {
+    if (y < 0 || y > 479) return ;
+    if (x < 0) {
+        w += x ;
+        x = 0 ;
+    }
+    if (x + w > 640) w = 640 - x ;
+    if (w <= 0) return ;
+
+    int pixel = (640 * y) + x ;
+    int end = pixel + w ;
+    if (pixel & 1) {
+        drawPixelFast(x, y, color) ;
+        pixel++ ;
+    }
+    unsigned char pair = (color << 3) | color ;
+    unsigned char * p = &vga_data_array[pixel>>1] ;
+    unsigned char * stop = &vga_data_array[end>>1] ;
+    while (p < stop) {
+        *p++ = pair ;
+    }
+    if (end & 1) {
+        vga_data_array[end>>1] = (vga_data_array[end>>1] & BOTTOMMASK) | (color) ;
+    }
+}
+
 // Bresenham's algorithm - thx wikipedia and thx Bruce!
 void drawLine(short x0, short y0, short x1, short y1, char color) {
 /* Draw a straight line from (x0,y0) to (x1,y1) with given color
@@ -33,6 +33,12 @@ void initVGA(void) ;
 void drawPixel(short x, short y, char color) ;
 void drawVLine(short x, short y, short h, char color) ;
 void drawHLine(short x, short y, short w, char color) ;
+// Fast writers: drawPixelFast and readPixel do no range checks (the
+// caller clips), drawSpan clips once and stores two pixels per byte along
+// the span
+void drawPixelFast(short x, short y, char color) ;
+char readPixel(short x, short y) ;
+void drawSpan(short x, short y, short w, char color) ;
 void drawLine(short x0, short y0, short x1, short y1, char color) ;
 void drawRect(short x, short y, short w, short h, char color);
 void drawCircle(short x0, short y0, short r, char color) ;